@@ -0,0 +1,132 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/Doxygen.cmake"
+  "/root/repo/cmake/MKL.cmake"
+  "/root/repo/cmake/OpenMP.cmake"
+  "/root/repo/cmake/SDL.cmake"
+  "/root/repo/cmake/TBB.cmake"
+  "/root/repo/cmake/Threadpool.cmake"
+  "/root/repo/cmake/options.cmake"
+  "/root/repo/cmake/platform.cmake"
+  "/root/repo/cmake/profiling.cmake"
+  "/root/repo/cmake/utils.cmake"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/tests/CMakeLists.txt"
+  "/root/repo/tests/benchdnn/CMakeLists.txt"
+  "/root/repo/tests/gtests/CMakeLists.txt"
+  "/root/repo/tests/gtests/gtest/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/gtests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/gtests/gtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "tests/benchdnn/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "src/CMakeFiles/mkldnn.dir/DependInfo.cmake"
+  "examples/CMakeFiles/simple-net-c.dir/DependInfo.cmake"
+  "examples/CMakeFiles/simple-net-cpp.dir/DependInfo.cmake"
+  "examples/CMakeFiles/simple-training-net-c.dir/DependInfo.cmake"
+  "examples/CMakeFiles/simple-training-net-cpp.dir/DependInfo.cmake"
+  "examples/CMakeFiles/simple-net-int8-cpp.dir/DependInfo.cmake"
+  "tests/CMakeFiles/api-c.dir/DependInfo.cmake"
+  "tests/CMakeFiles/test_c_symbols-c.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_batch_normalization.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_concat.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_backward_data_f32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_backward_data_s16s16s32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_backward_weights_f32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_backward_weights_s16s16s32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_dw_fusion.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_fft.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_format_any.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_forward_f32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_forward_s16s16s32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_forward_u8s8fp.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_forward_u8s8s32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_relu_forward_f32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_relu_forward_neg_slope_f32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_relu_forward_s16s16s32.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_convolution_winograd.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_deconvolution.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_eltwise.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_gemm.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_iface_attr.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_iface_pd_iter.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_iface_tuning.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_inner_product_backward_data.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_inner_product_backward_weights.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_inner_product_forward.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_lrn_backward.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_lrn_forward.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_memory.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_mkldnn_threading.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_pooling_backward.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_pooling_forward.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_relu.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_reorder.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_shuffle.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_softmax_backward.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_softmax_forward.dir/DependInfo.cmake"
+  "tests/gtests/CMakeFiles/test_sum.dir/DependInfo.cmake"
+  "tests/gtests/gtest/CMakeFiles/mkldnn_gtest.dir/DependInfo.cmake"
+  "tests/benchdnn/CMakeFiles/benchdnn.dir/DependInfo.cmake"
+  "tests/benchdnn/CMakeFiles/test_conv.dir/DependInfo.cmake"
+  "tests/benchdnn/CMakeFiles/test_benchdnn_conv.dir/DependInfo.cmake"
+  "tests/benchdnn/CMakeFiles/test_benchdnn_deconv.dir/DependInfo.cmake"
+  "tests/benchdnn/CMakeFiles/test_benchdnn_rnn.dir/DependInfo.cmake"
+  "tests/benchdnn/CMakeFiles/test_benchdnn_reorder.dir/DependInfo.cmake"
+  "tests/benchdnn/CMakeFiles/test_benchdnn_bnorm.dir/DependInfo.cmake"
+  "tests/benchdnn/CMakeFiles/test_benchdnn_ip.dir/DependInfo.cmake"
+  "tests/benchdnn/CMakeFiles/test_benchdnn_regression.dir/DependInfo.cmake"
+  )
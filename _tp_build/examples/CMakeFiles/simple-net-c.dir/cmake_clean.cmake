@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple-net-c.dir/simple_net.c.o"
+  "CMakeFiles/simple-net-c.dir/simple_net.c.o.d"
+  "simple-net-c"
+  "simple-net-c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/simple-net-c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple-net-cpp.dir/simple_net.cpp.o"
+  "CMakeFiles/simple-net-cpp.dir/simple_net.cpp.o.d"
+  "simple-net-cpp"
+  "simple-net-cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple-net-cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple-net-int8-cpp.dir/simple_net_int8.cpp.o"
+  "CMakeFiles/simple-net-int8-cpp.dir/simple_net_int8.cpp.o.d"
+  "simple-net-int8-cpp"
+  "simple-net-int8-cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple-net-int8-cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
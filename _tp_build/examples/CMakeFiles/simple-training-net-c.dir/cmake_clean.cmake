@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple-training-net-c.dir/simple_training_net.c.o"
+  "CMakeFiles/simple-training-net-c.dir/simple_training_net.c.o.d"
+  "simple-training-net-c"
+  "simple-training-net-c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/simple-training-net-c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simple-training-net-cpp.dir/simple_training_net.cpp.o"
+  "CMakeFiles/simple-training-net-cpp.dir/simple_training_net.cpp.o.d"
+  "simple-training-net-cpp"
+  "simple-training-net-cpp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simple-training-net-cpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples
+# Build directory: /root/repo/_tp_build/examples
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(simple-net-c "simple-net-c")
+set_tests_properties(simple-net-c PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/examples/CMakeLists.txt;27;register_exe;/root/repo/examples/CMakeLists.txt;0;")
+add_test(simple-net-cpp "simple-net-cpp")
+set_tests_properties(simple-net-cpp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/examples/CMakeLists.txt;28;register_exe;/root/repo/examples/CMakeLists.txt;0;")
+add_test(simple-training-net-c "simple-training-net-c")
+set_tests_properties(simple-training-net-c PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/examples/CMakeLists.txt;32;register_exe;/root/repo/examples/CMakeLists.txt;0;")
+add_test(simple-training-net-cpp "simple-training-net-cpp")
+set_tests_properties(simple-training-net-cpp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/examples/CMakeLists.txt;33;register_exe;/root/repo/examples/CMakeLists.txt;0;")
+add_test(simple-net-int8-cpp "simple-net-int8-cpp")
+set_tests_properties(simple-net-int8-cpp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/examples/CMakeLists.txt;34;register_exe;/root/repo/examples/CMakeLists.txt;0;")
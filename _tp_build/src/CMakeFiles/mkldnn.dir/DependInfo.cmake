@@ -0,0 +1,126 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/common/batch_normalization.cpp" "src/CMakeFiles/mkldnn.dir/common/batch_normalization.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/batch_normalization.cpp.o.d"
+  "/root/repo/src/common/convolution.cpp" "src/CMakeFiles/mkldnn.dir/common/convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/convolution.cpp.o.d"
+  "/root/repo/src/common/convolution_relu.cpp" "src/CMakeFiles/mkldnn.dir/common/convolution_relu.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/convolution_relu.cpp.o.d"
+  "/root/repo/src/common/deconvolution.cpp" "src/CMakeFiles/mkldnn.dir/common/deconvolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/deconvolution.cpp.o.d"
+  "/root/repo/src/common/eltwise.cpp" "src/CMakeFiles/mkldnn.dir/common/eltwise.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/eltwise.cpp.o.d"
+  "/root/repo/src/common/engine.cpp" "src/CMakeFiles/mkldnn.dir/common/engine.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/engine.cpp.o.d"
+  "/root/repo/src/common/inner_product.cpp" "src/CMakeFiles/mkldnn.dir/common/inner_product.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/inner_product.cpp.o.d"
+  "/root/repo/src/common/lrn.cpp" "src/CMakeFiles/mkldnn.dir/common/lrn.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/lrn.cpp.o.d"
+  "/root/repo/src/common/memory.cpp" "src/CMakeFiles/mkldnn.dir/common/memory.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/memory.cpp.o.d"
+  "/root/repo/src/common/memory_desc_wrapper.cpp" "src/CMakeFiles/mkldnn.dir/common/memory_desc_wrapper.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/memory_desc_wrapper.cpp.o.d"
+  "/root/repo/src/common/mkldnn_debug.cpp" "src/CMakeFiles/mkldnn.dir/common/mkldnn_debug.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/mkldnn_debug.cpp.o.d"
+  "/root/repo/src/common/mkldnn_thread.cpp" "src/CMakeFiles/mkldnn.dir/common/mkldnn_thread.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/mkldnn_thread.cpp.o.d"
+  "/root/repo/src/common/numa.cpp" "src/CMakeFiles/mkldnn.dir/common/numa.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/numa.cpp.o.d"
+  "/root/repo/src/common/pooling.cpp" "src/CMakeFiles/mkldnn.dir/common/pooling.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/pooling.cpp.o.d"
+  "/root/repo/src/common/primitive.cpp" "src/CMakeFiles/mkldnn.dir/common/primitive.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/primitive.cpp.o.d"
+  "/root/repo/src/common/primitive_attr.cpp" "src/CMakeFiles/mkldnn.dir/common/primitive_attr.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/primitive_attr.cpp.o.d"
+  "/root/repo/src/common/primitive_desc.cpp" "src/CMakeFiles/mkldnn.dir/common/primitive_desc.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/primitive_desc.cpp.o.d"
+  "/root/repo/src/common/primitive_iterator.cpp" "src/CMakeFiles/mkldnn.dir/common/primitive_iterator.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/primitive_iterator.cpp.o.d"
+  "/root/repo/src/common/query.cpp" "src/CMakeFiles/mkldnn.dir/common/query.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/query.cpp.o.d"
+  "/root/repo/src/common/reorder.cpp" "src/CMakeFiles/mkldnn.dir/common/reorder.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/reorder.cpp.o.d"
+  "/root/repo/src/common/rnn.cpp" "src/CMakeFiles/mkldnn.dir/common/rnn.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/rnn.cpp.o.d"
+  "/root/repo/src/common/scratchpad.cpp" "src/CMakeFiles/mkldnn.dir/common/scratchpad.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/scratchpad.cpp.o.d"
+  "/root/repo/src/common/shuffle.cpp" "src/CMakeFiles/mkldnn.dir/common/shuffle.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/shuffle.cpp.o.d"
+  "/root/repo/src/common/softmax.cpp" "src/CMakeFiles/mkldnn.dir/common/softmax.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/softmax.cpp.o.d"
+  "/root/repo/src/common/stream.cpp" "src/CMakeFiles/mkldnn.dir/common/stream.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/stream.cpp.o.d"
+  "/root/repo/src/common/tuning.cpp" "src/CMakeFiles/mkldnn.dir/common/tuning.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/tuning.cpp.o.d"
+  "/root/repo/src/common/utils.cpp" "src/CMakeFiles/mkldnn.dir/common/utils.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/utils.cpp.o.d"
+  "/root/repo/src/common/verbose.cpp" "src/CMakeFiles/mkldnn.dir/common/verbose.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/common/verbose.cpp.o.d"
+  "/root/repo/src/cpu/cpu_barrier.cpp" "src/CMakeFiles/mkldnn.dir/cpu/cpu_barrier.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/cpu_barrier.cpp.o.d"
+  "/root/repo/src/cpu/cpu_batch_normalization_utils.cpp" "src/CMakeFiles/mkldnn.dir/cpu/cpu_batch_normalization_utils.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/cpu_batch_normalization_utils.cpp.o.d"
+  "/root/repo/src/cpu/cpu_concat.cpp" "src/CMakeFiles/mkldnn.dir/cpu/cpu_concat.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/cpu_concat.cpp.o.d"
+  "/root/repo/src/cpu/cpu_engine.cpp" "src/CMakeFiles/mkldnn.dir/cpu/cpu_engine.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/cpu_engine.cpp.o.d"
+  "/root/repo/src/cpu/cpu_memory.cpp" "src/CMakeFiles/mkldnn.dir/cpu/cpu_memory.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/cpu_memory.cpp.o.d"
+  "/root/repo/src/cpu/cpu_reducer.cpp" "src/CMakeFiles/mkldnn.dir/cpu/cpu_reducer.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/cpu_reducer.cpp.o.d"
+  "/root/repo/src/cpu/cpu_reorder.cpp" "src/CMakeFiles/mkldnn.dir/cpu/cpu_reorder.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/cpu_reorder.cpp.o.d"
+  "/root/repo/src/cpu/cpu_sum.cpp" "src/CMakeFiles/mkldnn.dir/cpu/cpu_sum.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/cpu_sum.cpp.o.d"
+  "/root/repo/src/cpu/fft_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/fft_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/fft_convolution.cpp.o.d"
+  "/root/repo/src/cpu/gemm/gemm.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm/gemm.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm/gemm.cpp.o.d"
+  "/root/repo/src/cpu/gemm/gemm_utils.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm/gemm_utils.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm/gemm_utils.cpp.o.d"
+  "/root/repo/src/cpu/gemm/jit_avx512_common_gemm_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm/jit_avx512_common_gemm_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm/jit_avx512_common_gemm_f32.cpp.o.d"
+  "/root/repo/src/cpu/gemm/jit_avx_gemm_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm/jit_avx_gemm_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm/jit_avx_gemm_f32.cpp.o.d"
+  "/root/repo/src/cpu/gemm/ref_gemm.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm/ref_gemm.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm/ref_gemm.cpp.o.d"
+  "/root/repo/src/cpu/gemm/small_gemm.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm/small_gemm.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm/small_gemm.cpp.o.d"
+  "/root/repo/src/cpu/gemm_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm_convolution.cpp.o.d"
+  "/root/repo/src/cpu/gemm_convolution_utils.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm_convolution_utils.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm_convolution_utils.cpp.o.d"
+  "/root/repo/src/cpu/gemm_inner_product.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm_inner_product.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm_inner_product.cpp.o.d"
+  "/root/repo/src/cpu/gemm_u8s8s32x_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm_u8s8s32x_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm_u8s8s32x_convolution.cpp.o.d"
+  "/root/repo/src/cpu/gemm_u8s8s32x_inner_product.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm_u8s8s32x_inner_product.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm_u8s8s32x_inner_product.cpp.o.d"
+  "/root/repo/src/cpu/gemm_wino_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/gemm_wino_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/gemm_wino_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx2_1x1_conv_kernel_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx2_1x1_conv_kernel_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx2_1x1_conv_kernel_f32.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx2_1x1_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx2_1x1_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx2_1x1_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx2_conv_kernel_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx2_conv_kernel_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx2_conv_kernel_f32.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx2_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx2_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx2_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_common_1x1_conv_kernel.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_conv_kernel.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_conv_kernel.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_common_1x1_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_common_1x1_dw_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_dw_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_dw_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_common_conv_kernel.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_conv_kernel.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_conv_kernel.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_common_conv_winograd_kernel_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_conv_winograd_kernel_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_conv_winograd_kernel_f32.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_common_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_common_convolution_winograd.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_convolution_winograd.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_convolution_winograd.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_common_lrn.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_lrn.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_lrn.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_core_fp32_wino_conv_2x3.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_2x3.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_2x3.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_core_fp32_wino_conv_4x3.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_4x3.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_4x3.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_core_fp32_wino_conv_4x3_kernel.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_4x3_kernel.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_4x3_kernel.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_core_i8i8_pooling.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_i8i8_pooling.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_i8i8_pooling.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_core_u8s8s32x_wino_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_u8s8s32x_wino_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_u8s8s32x_wino_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_core_x8s8s32x_1x1_conv_kernel.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_1x1_conv_kernel.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_1x1_conv_kernel.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_core_x8s8s32x_1x1_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_1x1_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_1x1_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_core_x8s8s32x_conv_kernel.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_conv_kernel.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_conv_kernel.cpp.o.d"
+  "/root/repo/src/cpu/jit_avx512_core_x8s8s32x_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_sse42_1x1_conv_kernel_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_sse42_1x1_conv_kernel_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_sse42_1x1_conv_kernel_f32.cpp.o.d"
+  "/root/repo/src/cpu/jit_sse42_1x1_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_sse42_1x1_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_sse42_1x1_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_sse42_conv_kernel_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_sse42_conv_kernel_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_sse42_conv_kernel_f32.cpp.o.d"
+  "/root/repo/src/cpu/jit_sse42_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_sse42_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_sse42_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_transpose_src_utils.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_transpose_src_utils.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_transpose_src_utils.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_batch_normalization.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_batch_normalization.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_batch_normalization.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_dw_conv_kernel_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_dw_conv_kernel_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_dw_conv_kernel_f32.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_dw_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_dw_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_dw_convolution.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_eltwise.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_eltwise.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_eltwise.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_lrn.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_lrn.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_lrn.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_lrn_kernel_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_lrn_kernel_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_lrn_kernel_f32.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_pool_kernel_f32.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_pool_kernel_f32.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_pool_kernel_f32.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_pooling.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_pooling.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_pooling.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_reorder.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_reorder.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_reorder.cpp.o.d"
+  "/root/repo/src/cpu/jit_uni_reorder_utils.cpp" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_reorder_utils.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/jit_uni_reorder_utils.cpp.o.d"
+  "/root/repo/src/cpu/nchw_pooling.cpp" "src/CMakeFiles/mkldnn.dir/cpu/nchw_pooling.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/nchw_pooling.cpp.o.d"
+  "/root/repo/src/cpu/ncsp_batch_normalization.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ncsp_batch_normalization.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ncsp_batch_normalization.cpp.o.d"
+  "/root/repo/src/cpu/nhwc_pooling.cpp" "src/CMakeFiles/mkldnn.dir/cpu/nhwc_pooling.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/nhwc_pooling.cpp.o.d"
+  "/root/repo/src/cpu/nspc_batch_normalization.cpp" "src/CMakeFiles/mkldnn.dir/cpu/nspc_batch_normalization.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/nspc_batch_normalization.cpp.o.d"
+  "/root/repo/src/cpu/ref_batch_normalization.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_batch_normalization.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_batch_normalization.cpp.o.d"
+  "/root/repo/src/cpu/ref_convolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_convolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_convolution.cpp.o.d"
+  "/root/repo/src/cpu/ref_deconvolution.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_deconvolution.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_deconvolution.cpp.o.d"
+  "/root/repo/src/cpu/ref_eltwise.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_eltwise.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_eltwise.cpp.o.d"
+  "/root/repo/src/cpu/ref_inner_product.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_inner_product.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_inner_product.cpp.o.d"
+  "/root/repo/src/cpu/ref_lrn.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_lrn.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_lrn.cpp.o.d"
+  "/root/repo/src/cpu/ref_pooling.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_pooling.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_pooling.cpp.o.d"
+  "/root/repo/src/cpu/ref_rnn.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_rnn.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_rnn.cpp.o.d"
+  "/root/repo/src/cpu/ref_shuffle.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_shuffle.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_shuffle.cpp.o.d"
+  "/root/repo/src/cpu/ref_softmax.cpp" "src/CMakeFiles/mkldnn.dir/cpu/ref_softmax.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/ref_softmax.cpp.o.d"
+  "/root/repo/src/cpu/simple_concat.cpp" "src/CMakeFiles/mkldnn.dir/cpu/simple_concat.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/simple_concat.cpp.o.d"
+  "/root/repo/src/cpu/simple_sum.cpp" "src/CMakeFiles/mkldnn.dir/cpu/simple_sum.cpp.o" "gcc" "src/CMakeFiles/mkldnn.dir/cpu/simple_sum.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_tp_build/src/libmkldnn.so" "/root/repo/_tp_build/src/libmkldnn.so.0.16.0"
+  "/root/repo/_tp_build/src/libmkldnn.so.0" "/root/repo/_tp_build/src/libmkldnn.so.0.16.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
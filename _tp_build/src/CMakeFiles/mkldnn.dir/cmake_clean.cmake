@@ -0,0 +1,213 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mkldnn.dir/common/batch_normalization.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/batch_normalization.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/convolution_relu.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/convolution_relu.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/deconvolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/deconvolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/eltwise.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/eltwise.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/engine.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/engine.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/inner_product.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/inner_product.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/lrn.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/lrn.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/memory.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/memory.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/memory_desc_wrapper.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/memory_desc_wrapper.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/mkldnn_debug.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/mkldnn_debug.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/mkldnn_thread.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/mkldnn_thread.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/numa.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/numa.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/pooling.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/pooling.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/primitive.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/primitive.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/primitive_attr.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/primitive_attr.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/primitive_desc.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/primitive_desc.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/primitive_iterator.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/primitive_iterator.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/query.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/query.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/reorder.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/reorder.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/rnn.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/rnn.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/scratchpad.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/scratchpad.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/shuffle.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/shuffle.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/softmax.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/softmax.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/stream.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/stream.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/tuning.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/tuning.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/utils.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/utils.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/common/verbose.cpp.o"
+  "CMakeFiles/mkldnn.dir/common/verbose.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_barrier.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_barrier.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_batch_normalization_utils.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_batch_normalization_utils.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_concat.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_concat.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_engine.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_engine.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_memory.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_memory.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_reducer.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_reducer.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_reorder.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_reorder.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_sum.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/cpu_sum.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/fft_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/fft_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/gemm.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/gemm.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/gemm_utils.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/gemm_utils.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/jit_avx512_common_gemm_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/jit_avx512_common_gemm_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/jit_avx_gemm_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/jit_avx_gemm_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/ref_gemm.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/ref_gemm.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/small_gemm.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm/small_gemm.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_convolution_utils.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_convolution_utils.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_inner_product.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_inner_product.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_u8s8s32x_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_u8s8s32x_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_u8s8s32x_inner_product.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_u8s8s32x_inner_product.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_wino_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/gemm_wino_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx2_1x1_conv_kernel_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx2_1x1_conv_kernel_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx2_1x1_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx2_1x1_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx2_conv_kernel_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx2_conv_kernel_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx2_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx2_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_conv_kernel.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_conv_kernel.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_dw_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_1x1_dw_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_conv_kernel.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_conv_kernel.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_conv_winograd_kernel_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_conv_winograd_kernel_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_convolution_winograd.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_convolution_winograd.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_lrn.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_common_lrn.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_2x3.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_2x3.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_4x3.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_4x3.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_4x3_kernel.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_fp32_wino_conv_4x3_kernel.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_i8i8_pooling.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_i8i8_pooling.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_u8s8s32x_wino_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_u8s8s32x_wino_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_1x1_conv_kernel.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_1x1_conv_kernel.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_1x1_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_1x1_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_conv_kernel.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_conv_kernel.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_avx512_core_x8s8s32x_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_sse42_1x1_conv_kernel_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_sse42_1x1_conv_kernel_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_sse42_1x1_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_sse42_1x1_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_sse42_conv_kernel_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_sse42_conv_kernel_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_sse42_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_sse42_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_transpose_src_utils.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_transpose_src_utils.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_batch_normalization.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_batch_normalization.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_dw_conv_kernel_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_dw_conv_kernel_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_dw_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_dw_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_eltwise.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_eltwise.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_lrn.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_lrn.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_lrn_kernel_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_lrn_kernel_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_pool_kernel_f32.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_pool_kernel_f32.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_pooling.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_pooling.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_reorder.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_reorder.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_reorder_utils.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/jit_uni_reorder_utils.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/nchw_pooling.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/nchw_pooling.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ncsp_batch_normalization.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ncsp_batch_normalization.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/nhwc_pooling.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/nhwc_pooling.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/nspc_batch_normalization.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/nspc_batch_normalization.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_batch_normalization.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_batch_normalization.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_convolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_convolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_deconvolution.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_deconvolution.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_eltwise.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_eltwise.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_inner_product.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_inner_product.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_lrn.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_lrn.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_pooling.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_pooling.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_rnn.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_rnn.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_shuffle.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_shuffle.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/ref_softmax.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/ref_softmax.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/simple_concat.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/simple_concat.cpp.o.d"
+  "CMakeFiles/mkldnn.dir/cpu/simple_sum.cpp.o"
+  "CMakeFiles/mkldnn.dir/cpu/simple_sum.cpp.o.d"
+  "libmkldnn.pdb"
+  "libmkldnn.so"
+  "libmkldnn.so.0"
+  "libmkldnn.so.0.16.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mkldnn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/api-c.dir/api.c.o"
+  "CMakeFiles/api-c.dir/api.c.o.d"
+  "api-c"
+  "api-c.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/api-c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_c_symbols-c.dir/test_c_symbols.c.o"
+  "CMakeFiles/test_c_symbols-c.dir/test_c_symbols.c.o.d"
+  "test_c_symbols-c"
+  "test_c_symbols-c.pdb"
+  "test_c_symbols.c"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_c_symbols-c.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
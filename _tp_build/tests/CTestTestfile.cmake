@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests
+# Build directory: /root/repo/_tp_build/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(api-c "api-c")
+set_tests_properties(api-c PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/CMakeLists.txt;65;register_exe;/root/repo/tests/CMakeLists.txt;0;")
+add_test(test_c_symbols-c "test_c_symbols-c")
+set_tests_properties(test_c_symbols-c PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/CMakeLists.txt;74;register_exe;/root/repo/tests/CMakeLists.txt;0;")
+subdirs("gtests")
+subdirs("benchdnn")
@@ -0,0 +1,64 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/benchdnn/benchdnn.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/benchdnn.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/benchdnn.cpp.o.d"
+  "/root/repo/tests/benchdnn/bnorm/bench_bnorm.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/bench_bnorm.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/bench_bnorm.cpp.o.d"
+  "/root/repo/tests/benchdnn/bnorm/bnorm.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/bnorm.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/bnorm.cpp.o.d"
+  "/root/repo/tests/benchdnn/bnorm/bnorm_aux.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/bnorm_aux.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/bnorm_aux.cpp.o.d"
+  "/root/repo/tests/benchdnn/bnorm/perf_report.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/perf_report.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/perf_report.cpp.o.d"
+  "/root/repo/tests/benchdnn/bnorm/ref_bnorm.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/ref_bnorm.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/bnorm/ref_bnorm.cpp.o.d"
+  "/root/repo/tests/benchdnn/common.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/common.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/common.cpp.o.d"
+  "/root/repo/tests/benchdnn/conv/bench_conv.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/bench_conv.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/bench_conv.cpp.o.d"
+  "/root/repo/tests/benchdnn/conv/bench_deconv.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/bench_deconv.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/bench_deconv.cpp.o.d"
+  "/root/repo/tests/benchdnn/conv/cfg.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/cfg.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/cfg.cpp.o.d"
+  "/root/repo/tests/benchdnn/conv/conv.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/conv.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/conv.cpp.o.d"
+  "/root/repo/tests/benchdnn/conv/conv_aux.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/conv_aux.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/conv_aux.cpp.o.d"
+  "/root/repo/tests/benchdnn/conv/deconv.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/deconv.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/deconv.cpp.o.d"
+  "/root/repo/tests/benchdnn/conv/perf_report.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/perf_report.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/perf_report.cpp.o.d"
+  "/root/repo/tests/benchdnn/conv/ref_conv.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/ref_conv.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/ref_conv.cpp.o.d"
+  "/root/repo/tests/benchdnn/conv/ref_wino.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/ref_wino.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/conv/ref_wino.cpp.o.d"
+  "/root/repo/tests/benchdnn/dnn_types.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/dnn_types.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/dnn_types.cpp.o.d"
+  "/root/repo/tests/benchdnn/ip/bench_ip.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/bench_ip.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/bench_ip.cpp.o.d"
+  "/root/repo/tests/benchdnn/ip/cfg.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/cfg.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/cfg.cpp.o.d"
+  "/root/repo/tests/benchdnn/ip/ip.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/ip.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/ip.cpp.o.d"
+  "/root/repo/tests/benchdnn/ip/ip_aux.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/ip_aux.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/ip_aux.cpp.o.d"
+  "/root/repo/tests/benchdnn/ip/perf_report.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/perf_report.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/perf_report.cpp.o.d"
+  "/root/repo/tests/benchdnn/ip/ref_ip.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/ref_ip.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/ip/ref_ip.cpp.o.d"
+  "/root/repo/tests/benchdnn/mkldnn_common.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/mkldnn_common.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/mkldnn_common.cpp.o.d"
+  "/root/repo/tests/benchdnn/mkldnn_debug.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/mkldnn_debug.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/mkldnn_debug.cpp.o.d"
+  "/root/repo/tests/benchdnn/reorder/bench_reorder.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/bench_reorder.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/bench_reorder.cpp.o.d"
+  "/root/repo/tests/benchdnn/reorder/cfg.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/cfg.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/cfg.cpp.o.d"
+  "/root/repo/tests/benchdnn/reorder/perf_report.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/perf_report.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/perf_report.cpp.o.d"
+  "/root/repo/tests/benchdnn/reorder/reorder.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/reorder.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/reorder.cpp.o.d"
+  "/root/repo/tests/benchdnn/reorder/reorder_aux.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/reorder_aux.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/reorder/reorder_aux.cpp.o.d"
+  "/root/repo/tests/benchdnn/rnn/bench_rnn.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/bench_rnn.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/bench_rnn.cpp.o.d"
+  "/root/repo/tests/benchdnn/rnn/cfg.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/cfg.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/cfg.cpp.o.d"
+  "/root/repo/tests/benchdnn/rnn/perf_report.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/perf_report.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/perf_report.cpp.o.d"
+  "/root/repo/tests/benchdnn/rnn/ref_rnn.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/ref_rnn.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/ref_rnn.cpp.o.d"
+  "/root/repo/tests/benchdnn/rnn/rnn.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/rnn.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/rnn.cpp.o.d"
+  "/root/repo/tests/benchdnn/rnn/rnn_aux.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/rnn_aux.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/rnn/rnn_aux.cpp.o.d"
+  "/root/repo/tests/benchdnn/self/bnorm.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/self/bnorm.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/self/bnorm.cpp.o.d"
+  "/root/repo/tests/benchdnn/self/common.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/self/common.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/self/common.cpp.o.d"
+  "/root/repo/tests/benchdnn/self/conv.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/self/conv.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/self/conv.cpp.o.d"
+  "/root/repo/tests/benchdnn/self/self.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/self/self.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/self/self.cpp.o.d"
+  "/root/repo/tests/benchdnn/shuffle/bench_shuffle.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/bench_shuffle.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/bench_shuffle.cpp.o.d"
+  "/root/repo/tests/benchdnn/shuffle/perf_report.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/perf_report.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/perf_report.cpp.o.d"
+  "/root/repo/tests/benchdnn/shuffle/ref_shuffle.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/ref_shuffle.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/ref_shuffle.cpp.o.d"
+  "/root/repo/tests/benchdnn/shuffle/shuffle.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/shuffle.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/shuffle.cpp.o.d"
+  "/root/repo/tests/benchdnn/shuffle/shuffle_aux.cpp" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/shuffle_aux.cpp.o" "gcc" "tests/benchdnn/CMakeFiles/benchdnn.dir/shuffle/shuffle_aux.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_tp_build/src/CMakeFiles/mkldnn.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,99 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchdnn.dir/benchdnn.cpp.o"
+  "CMakeFiles/benchdnn.dir/benchdnn.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/bnorm/bench_bnorm.cpp.o"
+  "CMakeFiles/benchdnn.dir/bnorm/bench_bnorm.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/bnorm/bnorm.cpp.o"
+  "CMakeFiles/benchdnn.dir/bnorm/bnorm.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/bnorm/bnorm_aux.cpp.o"
+  "CMakeFiles/benchdnn.dir/bnorm/bnorm_aux.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/bnorm/perf_report.cpp.o"
+  "CMakeFiles/benchdnn.dir/bnorm/perf_report.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/bnorm/ref_bnorm.cpp.o"
+  "CMakeFiles/benchdnn.dir/bnorm/ref_bnorm.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/common.cpp.o"
+  "CMakeFiles/benchdnn.dir/common.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/conv/bench_conv.cpp.o"
+  "CMakeFiles/benchdnn.dir/conv/bench_conv.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/conv/bench_deconv.cpp.o"
+  "CMakeFiles/benchdnn.dir/conv/bench_deconv.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/conv/cfg.cpp.o"
+  "CMakeFiles/benchdnn.dir/conv/cfg.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/conv/conv.cpp.o"
+  "CMakeFiles/benchdnn.dir/conv/conv.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/conv/conv_aux.cpp.o"
+  "CMakeFiles/benchdnn.dir/conv/conv_aux.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/conv/deconv.cpp.o"
+  "CMakeFiles/benchdnn.dir/conv/deconv.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/conv/perf_report.cpp.o"
+  "CMakeFiles/benchdnn.dir/conv/perf_report.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/conv/ref_conv.cpp.o"
+  "CMakeFiles/benchdnn.dir/conv/ref_conv.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/conv/ref_wino.cpp.o"
+  "CMakeFiles/benchdnn.dir/conv/ref_wino.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/dnn_types.cpp.o"
+  "CMakeFiles/benchdnn.dir/dnn_types.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/ip/bench_ip.cpp.o"
+  "CMakeFiles/benchdnn.dir/ip/bench_ip.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/ip/cfg.cpp.o"
+  "CMakeFiles/benchdnn.dir/ip/cfg.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/ip/ip.cpp.o"
+  "CMakeFiles/benchdnn.dir/ip/ip.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/ip/ip_aux.cpp.o"
+  "CMakeFiles/benchdnn.dir/ip/ip_aux.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/ip/perf_report.cpp.o"
+  "CMakeFiles/benchdnn.dir/ip/perf_report.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/ip/ref_ip.cpp.o"
+  "CMakeFiles/benchdnn.dir/ip/ref_ip.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/mkldnn_common.cpp.o"
+  "CMakeFiles/benchdnn.dir/mkldnn_common.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/mkldnn_debug.cpp.o"
+  "CMakeFiles/benchdnn.dir/mkldnn_debug.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/reorder/bench_reorder.cpp.o"
+  "CMakeFiles/benchdnn.dir/reorder/bench_reorder.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/reorder/cfg.cpp.o"
+  "CMakeFiles/benchdnn.dir/reorder/cfg.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/reorder/perf_report.cpp.o"
+  "CMakeFiles/benchdnn.dir/reorder/perf_report.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/reorder/reorder.cpp.o"
+  "CMakeFiles/benchdnn.dir/reorder/reorder.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/reorder/reorder_aux.cpp.o"
+  "CMakeFiles/benchdnn.dir/reorder/reorder_aux.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/rnn/bench_rnn.cpp.o"
+  "CMakeFiles/benchdnn.dir/rnn/bench_rnn.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/rnn/cfg.cpp.o"
+  "CMakeFiles/benchdnn.dir/rnn/cfg.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/rnn/perf_report.cpp.o"
+  "CMakeFiles/benchdnn.dir/rnn/perf_report.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/rnn/ref_rnn.cpp.o"
+  "CMakeFiles/benchdnn.dir/rnn/ref_rnn.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/rnn/rnn.cpp.o"
+  "CMakeFiles/benchdnn.dir/rnn/rnn.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/rnn/rnn_aux.cpp.o"
+  "CMakeFiles/benchdnn.dir/rnn/rnn_aux.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/self/bnorm.cpp.o"
+  "CMakeFiles/benchdnn.dir/self/bnorm.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/self/common.cpp.o"
+  "CMakeFiles/benchdnn.dir/self/common.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/self/conv.cpp.o"
+  "CMakeFiles/benchdnn.dir/self/conv.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/self/self.cpp.o"
+  "CMakeFiles/benchdnn.dir/self/self.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/shuffle/bench_shuffle.cpp.o"
+  "CMakeFiles/benchdnn.dir/shuffle/bench_shuffle.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/shuffle/perf_report.cpp.o"
+  "CMakeFiles/benchdnn.dir/shuffle/perf_report.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/shuffle/ref_shuffle.cpp.o"
+  "CMakeFiles/benchdnn.dir/shuffle/ref_shuffle.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/shuffle/shuffle.cpp.o"
+  "CMakeFiles/benchdnn.dir/shuffle/shuffle.cpp.o.d"
+  "CMakeFiles/benchdnn.dir/shuffle/shuffle_aux.cpp.o"
+  "CMakeFiles/benchdnn.dir/shuffle/shuffle_aux.cpp.o.d"
+  "benchdnn"
+  "benchdnn.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchdnn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
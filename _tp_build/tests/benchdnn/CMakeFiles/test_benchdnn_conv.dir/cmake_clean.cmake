@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_benchdnn_conv"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/test_benchdnn_conv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_benchdnn_ip"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/test_benchdnn_ip.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/benchdnn
+# Build directory: /root/repo/_tp_build/tests/benchdnn
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(benchdnn "benchdnn")
+set_tests_properties(benchdnn PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/benchdnn/CMakeLists.txt;48;register_exe;/root/repo/tests/benchdnn/CMakeLists.txt;0;")
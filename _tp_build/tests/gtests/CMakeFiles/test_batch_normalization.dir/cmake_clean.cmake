@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_batch_normalization.dir/main.cpp.o"
+  "CMakeFiles/test_batch_normalization.dir/main.cpp.o.d"
+  "CMakeFiles/test_batch_normalization.dir/test_batch_normalization.cpp.o"
+  "CMakeFiles/test_batch_normalization.dir/test_batch_normalization.cpp.o.d"
+  "test_batch_normalization"
+  "test_batch_normalization.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_batch_normalization.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
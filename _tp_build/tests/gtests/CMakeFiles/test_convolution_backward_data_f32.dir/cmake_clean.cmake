@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_backward_data_f32.dir/main.cpp.o"
+  "CMakeFiles/test_convolution_backward_data_f32.dir/main.cpp.o.d"
+  "CMakeFiles/test_convolution_backward_data_f32.dir/test_convolution_backward_data_f32.cpp.o"
+  "CMakeFiles/test_convolution_backward_data_f32.dir/test_convolution_backward_data_f32.cpp.o.d"
+  "test_convolution_backward_data_f32"
+  "test_convolution_backward_data_f32.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_backward_data_f32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/gtests/main.cpp" "tests/gtests/CMakeFiles/test_convolution_backward_weights_s16s16s32.dir/main.cpp.o" "gcc" "tests/gtests/CMakeFiles/test_convolution_backward_weights_s16s16s32.dir/main.cpp.o.d"
+  "/root/repo/tests/gtests/test_convolution_backward_weights_s16s16s32.cpp" "tests/gtests/CMakeFiles/test_convolution_backward_weights_s16s16s32.dir/test_convolution_backward_weights_s16s16s32.cpp.o" "gcc" "tests/gtests/CMakeFiles/test_convolution_backward_weights_s16s16s32.dir/test_convolution_backward_weights_s16s16s32.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_tp_build/src/CMakeFiles/mkldnn.dir/DependInfo.cmake"
+  "/root/repo/_tp_build/tests/gtests/gtest/CMakeFiles/mkldnn_gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_dw_fusion.dir/main.cpp.o"
+  "CMakeFiles/test_convolution_dw_fusion.dir/main.cpp.o.d"
+  "CMakeFiles/test_convolution_dw_fusion.dir/test_convolution_dw_fusion.cpp.o"
+  "CMakeFiles/test_convolution_dw_fusion.dir/test_convolution_dw_fusion.cpp.o.d"
+  "test_convolution_dw_fusion"
+  "test_convolution_dw_fusion.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_dw_fusion.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
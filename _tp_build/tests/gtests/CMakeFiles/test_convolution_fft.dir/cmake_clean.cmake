@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_fft.dir/main.cpp.o"
+  "CMakeFiles/test_convolution_fft.dir/main.cpp.o.d"
+  "CMakeFiles/test_convolution_fft.dir/test_convolution_fft.cpp.o"
+  "CMakeFiles/test_convolution_fft.dir/test_convolution_fft.cpp.o.d"
+  "test_convolution_fft"
+  "test_convolution_fft.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_fft.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_format_any.dir/main.cpp.o"
+  "CMakeFiles/test_convolution_format_any.dir/main.cpp.o.d"
+  "CMakeFiles/test_convolution_format_any.dir/test_convolution_format_any.cpp.o"
+  "CMakeFiles/test_convolution_format_any.dir/test_convolution_format_any.cpp.o.d"
+  "test_convolution_format_any"
+  "test_convolution_format_any.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_format_any.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_forward_s16s16s32.dir/main.cpp.o"
+  "CMakeFiles/test_convolution_forward_s16s16s32.dir/main.cpp.o.d"
+  "CMakeFiles/test_convolution_forward_s16s16s32.dir/test_convolution_forward_s16s16s32.cpp.o"
+  "CMakeFiles/test_convolution_forward_s16s16s32.dir/test_convolution_forward_s16s16s32.cpp.o.d"
+  "test_convolution_forward_s16s16s32"
+  "test_convolution_forward_s16s16s32.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_forward_s16s16s32.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
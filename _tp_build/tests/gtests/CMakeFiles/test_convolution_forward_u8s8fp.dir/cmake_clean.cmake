@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_forward_u8s8fp.dir/main.cpp.o"
+  "CMakeFiles/test_convolution_forward_u8s8fp.dir/main.cpp.o.d"
+  "CMakeFiles/test_convolution_forward_u8s8fp.dir/test_convolution_forward_u8s8fp.cpp.o"
+  "CMakeFiles/test_convolution_forward_u8s8fp.dir/test_convolution_forward_u8s8fp.cpp.o.d"
+  "test_convolution_forward_u8s8fp"
+  "test_convolution_forward_u8s8fp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_forward_u8s8fp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_convolution_winograd.dir/main.cpp.o"
+  "CMakeFiles/test_convolution_winograd.dir/main.cpp.o.d"
+  "CMakeFiles/test_convolution_winograd.dir/test_convolution_winograd.cpp.o"
+  "CMakeFiles/test_convolution_winograd.dir/test_convolution_winograd.cpp.o.d"
+  "test_convolution_winograd"
+  "test_convolution_winograd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_convolution_winograd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_eltwise.dir/main.cpp.o"
+  "CMakeFiles/test_eltwise.dir/main.cpp.o.d"
+  "CMakeFiles/test_eltwise.dir/test_eltwise.cpp.o"
+  "CMakeFiles/test_eltwise.dir/test_eltwise.cpp.o.d"
+  "test_eltwise"
+  "test_eltwise.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_eltwise.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
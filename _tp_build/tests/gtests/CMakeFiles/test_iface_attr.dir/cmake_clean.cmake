@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_iface_attr.dir/main.cpp.o"
+  "CMakeFiles/test_iface_attr.dir/main.cpp.o.d"
+  "CMakeFiles/test_iface_attr.dir/test_iface_attr.cpp.o"
+  "CMakeFiles/test_iface_attr.dir/test_iface_attr.cpp.o.d"
+  "test_iface_attr"
+  "test_iface_attr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_iface_attr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
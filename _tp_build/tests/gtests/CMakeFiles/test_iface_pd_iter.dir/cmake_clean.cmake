@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_iface_pd_iter.dir/main.cpp.o"
+  "CMakeFiles/test_iface_pd_iter.dir/main.cpp.o.d"
+  "CMakeFiles/test_iface_pd_iter.dir/test_iface_pd_iter.cpp.o"
+  "CMakeFiles/test_iface_pd_iter.dir/test_iface_pd_iter.cpp.o.d"
+  "test_iface_pd_iter"
+  "test_iface_pd_iter.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_iface_pd_iter.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_iface_tuning.dir/main.cpp.o"
+  "CMakeFiles/test_iface_tuning.dir/main.cpp.o.d"
+  "CMakeFiles/test_iface_tuning.dir/test_iface_tuning.cpp.o"
+  "CMakeFiles/test_iface_tuning.dir/test_iface_tuning.cpp.o.d"
+  "test_iface_tuning"
+  "test_iface_tuning.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_iface_tuning.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
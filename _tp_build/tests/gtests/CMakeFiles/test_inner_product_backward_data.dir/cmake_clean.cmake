@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_inner_product_backward_data.dir/main.cpp.o"
+  "CMakeFiles/test_inner_product_backward_data.dir/main.cpp.o.d"
+  "CMakeFiles/test_inner_product_backward_data.dir/test_inner_product_backward_data.cpp.o"
+  "CMakeFiles/test_inner_product_backward_data.dir/test_inner_product_backward_data.cpp.o.d"
+  "test_inner_product_backward_data"
+  "test_inner_product_backward_data.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_inner_product_backward_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_inner_product_backward_weights.dir/main.cpp.o"
+  "CMakeFiles/test_inner_product_backward_weights.dir/main.cpp.o.d"
+  "CMakeFiles/test_inner_product_backward_weights.dir/test_inner_product_backward_weights.cpp.o"
+  "CMakeFiles/test_inner_product_backward_weights.dir/test_inner_product_backward_weights.cpp.o.d"
+  "test_inner_product_backward_weights"
+  "test_inner_product_backward_weights.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_inner_product_backward_weights.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_inner_product_forward.dir/main.cpp.o"
+  "CMakeFiles/test_inner_product_forward.dir/main.cpp.o.d"
+  "CMakeFiles/test_inner_product_forward.dir/test_inner_product_forward.cpp.o"
+  "CMakeFiles/test_inner_product_forward.dir/test_inner_product_forward.cpp.o.d"
+  "test_inner_product_forward"
+  "test_inner_product_forward.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_inner_product_forward.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_lrn_backward.dir/main.cpp.o"
+  "CMakeFiles/test_lrn_backward.dir/main.cpp.o.d"
+  "CMakeFiles/test_lrn_backward.dir/test_lrn_backward.cpp.o"
+  "CMakeFiles/test_lrn_backward.dir/test_lrn_backward.cpp.o.d"
+  "test_lrn_backward"
+  "test_lrn_backward.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_lrn_backward.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_memory.dir/main.cpp.o"
+  "CMakeFiles/test_memory.dir/main.cpp.o.d"
+  "CMakeFiles/test_memory.dir/test_memory.cpp.o"
+  "CMakeFiles/test_memory.dir/test_memory.cpp.o.d"
+  "test_memory"
+  "test_memory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_memory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
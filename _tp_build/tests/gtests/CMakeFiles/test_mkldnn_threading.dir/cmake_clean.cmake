@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mkldnn_threading.dir/main.cpp.o"
+  "CMakeFiles/test_mkldnn_threading.dir/main.cpp.o.d"
+  "CMakeFiles/test_mkldnn_threading.dir/test_mkldnn_threading.cpp.o"
+  "CMakeFiles/test_mkldnn_threading.dir/test_mkldnn_threading.cpp.o.d"
+  "test_mkldnn_threading"
+  "test_mkldnn_threading.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mkldnn_threading.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pooling_backward.dir/main.cpp.o"
+  "CMakeFiles/test_pooling_backward.dir/main.cpp.o.d"
+  "CMakeFiles/test_pooling_backward.dir/test_pooling_backward.cpp.o"
+  "CMakeFiles/test_pooling_backward.dir/test_pooling_backward.cpp.o.d"
+  "test_pooling_backward"
+  "test_pooling_backward.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pooling_backward.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_pooling_forward.dir/main.cpp.o"
+  "CMakeFiles/test_pooling_forward.dir/main.cpp.o.d"
+  "CMakeFiles/test_pooling_forward.dir/test_pooling_forward.cpp.o"
+  "CMakeFiles/test_pooling_forward.dir/test_pooling_forward.cpp.o.d"
+  "test_pooling_forward"
+  "test_pooling_forward.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_pooling_forward.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
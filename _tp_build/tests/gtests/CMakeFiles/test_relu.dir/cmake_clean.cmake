@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_relu.dir/main.cpp.o"
+  "CMakeFiles/test_relu.dir/main.cpp.o.d"
+  "CMakeFiles/test_relu.dir/test_relu.cpp.o"
+  "CMakeFiles/test_relu.dir/test_relu.cpp.o.d"
+  "test_relu"
+  "test_relu.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_relu.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
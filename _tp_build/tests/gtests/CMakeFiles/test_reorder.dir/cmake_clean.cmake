@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_reorder.dir/main.cpp.o"
+  "CMakeFiles/test_reorder.dir/main.cpp.o.d"
+  "CMakeFiles/test_reorder.dir/test_reorder.cpp.o"
+  "CMakeFiles/test_reorder.dir/test_reorder.cpp.o.d"
+  "test_reorder"
+  "test_reorder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_reorder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
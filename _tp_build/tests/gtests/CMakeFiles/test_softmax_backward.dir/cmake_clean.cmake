@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_softmax_backward.dir/main.cpp.o"
+  "CMakeFiles/test_softmax_backward.dir/main.cpp.o.d"
+  "CMakeFiles/test_softmax_backward.dir/test_softmax_backward.cpp.o"
+  "CMakeFiles/test_softmax_backward.dir/test_softmax_backward.cpp.o.d"
+  "test_softmax_backward"
+  "test_softmax_backward.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_softmax_backward.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
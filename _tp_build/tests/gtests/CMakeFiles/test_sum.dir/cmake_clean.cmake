@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sum.dir/main.cpp.o"
+  "CMakeFiles/test_sum.dir/main.cpp.o.d"
+  "CMakeFiles/test_sum.dir/test_sum.cpp.o"
+  "CMakeFiles/test_sum.dir/test_sum.cpp.o.d"
+  "test_sum"
+  "test_sum.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,83 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/tests/gtests
+# Build directory: /root/repo/_tp_build/tests/gtests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_batch_normalization "test_batch_normalization")
+set_tests_properties(test_batch_normalization PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_concat "test_concat")
+set_tests_properties(test_concat PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_backward_data_f32 "test_convolution_backward_data_f32")
+set_tests_properties(test_convolution_backward_data_f32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_backward_data_s16s16s32 "test_convolution_backward_data_s16s16s32")
+set_tests_properties(test_convolution_backward_data_s16s16s32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_backward_weights_f32 "test_convolution_backward_weights_f32")
+set_tests_properties(test_convolution_backward_weights_f32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_backward_weights_s16s16s32 "test_convolution_backward_weights_s16s16s32")
+set_tests_properties(test_convolution_backward_weights_s16s16s32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_dw_fusion "test_convolution_dw_fusion")
+set_tests_properties(test_convolution_dw_fusion PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_fft "test_convolution_fft")
+set_tests_properties(test_convolution_fft PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_format_any "test_convolution_format_any")
+set_tests_properties(test_convolution_format_any PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_forward_f32 "test_convolution_forward_f32")
+set_tests_properties(test_convolution_forward_f32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_forward_s16s16s32 "test_convolution_forward_s16s16s32")
+set_tests_properties(test_convolution_forward_s16s16s32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_forward_u8s8fp "test_convolution_forward_u8s8fp")
+set_tests_properties(test_convolution_forward_u8s8fp PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_forward_u8s8s32 "test_convolution_forward_u8s8s32")
+set_tests_properties(test_convolution_forward_u8s8s32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_relu_forward_f32 "test_convolution_relu_forward_f32")
+set_tests_properties(test_convolution_relu_forward_f32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_relu_forward_neg_slope_f32 "test_convolution_relu_forward_neg_slope_f32")
+set_tests_properties(test_convolution_relu_forward_neg_slope_f32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_relu_forward_s16s16s32 "test_convolution_relu_forward_s16s16s32")
+set_tests_properties(test_convolution_relu_forward_s16s16s32 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_convolution_winograd "test_convolution_winograd")
+set_tests_properties(test_convolution_winograd PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_deconvolution "test_deconvolution")
+set_tests_properties(test_deconvolution PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_eltwise "test_eltwise")
+set_tests_properties(test_eltwise PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_gemm "test_gemm")
+set_tests_properties(test_gemm PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_iface_attr "test_iface_attr")
+set_tests_properties(test_iface_attr PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_iface_pd_iter "test_iface_pd_iter")
+set_tests_properties(test_iface_pd_iter PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_iface_tuning "test_iface_tuning")
+set_tests_properties(test_iface_tuning PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_inner_product_backward_data "test_inner_product_backward_data")
+set_tests_properties(test_inner_product_backward_data PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_inner_product_backward_weights "test_inner_product_backward_weights")
+set_tests_properties(test_inner_product_backward_weights PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_inner_product_forward "test_inner_product_forward")
+set_tests_properties(test_inner_product_forward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_lrn_backward "test_lrn_backward")
+set_tests_properties(test_lrn_backward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_lrn_forward "test_lrn_forward")
+set_tests_properties(test_lrn_forward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_memory "test_memory")
+set_tests_properties(test_memory PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_mkldnn_threading "test_mkldnn_threading")
+set_tests_properties(test_mkldnn_threading PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_pooling_backward "test_pooling_backward")
+set_tests_properties(test_pooling_backward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_pooling_forward "test_pooling_forward")
+set_tests_properties(test_pooling_forward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_relu "test_relu")
+set_tests_properties(test_relu PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_reorder "test_reorder")
+set_tests_properties(test_reorder PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_shuffle "test_shuffle")
+set_tests_properties(test_shuffle PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_softmax_backward "test_softmax_backward")
+set_tests_properties(test_softmax_backward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_softmax_forward "test_softmax_forward")
+set_tests_properties(test_softmax_forward PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+add_test(test_sum "test_sum")
+set_tests_properties(test_sum PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/cmake/utils.cmake;34;add_test;/root/repo/tests/gtests/CMakeLists.txt;80;register_exe;/root/repo/tests/gtests/CMakeLists.txt;0;")
+subdirs("gtest")
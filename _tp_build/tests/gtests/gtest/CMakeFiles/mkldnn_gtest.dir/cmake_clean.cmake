@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mkldnn_gtest.dir/src/gtest-all.cc.o"
+  "CMakeFiles/mkldnn_gtest.dir/src/gtest-all.cc.o.d"
+  "libmkldnn_gtest.a"
+  "libmkldnn_gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mkldnn_gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
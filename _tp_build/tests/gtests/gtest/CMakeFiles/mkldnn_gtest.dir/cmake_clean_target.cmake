@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libmkldnn_gtest.a"
+)
@@ -167,8 +167,9 @@ endfunction()
 #   MKL_THREADING_LAYER=tbb
 # to make Intel MKL use TBB threading as well, or
 #   MKL_THREADING_LAYER=sequential
-# to make Intel MKL be sequential.
-if(NOT MKLDNN_THREADING STREQUAL "TBB")
+# to make Intel MKL be sequential. The same holds for THREADPOOL, where the
+# latter is the only option.
+if(NOT MKLDNN_THREADING MATCHES "^(TBB|THREADPOOL)$")
     detect_mkl("mklml_intel")
     detect_mkl("mklml")
 endif()
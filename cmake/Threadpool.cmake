@@ -0,0 +1,37 @@
+#===============================================================================
+# Copyright 2018 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#===============================================================================
+
+# Manage threadpool-related compiler flags
+#===============================================================================
+
+if(Threadpool_cmake_included)
+    return()
+endif()
+set(Threadpool_cmake_included true)
+
+if(NOT MKLDNN_THREADING STREQUAL "THREADPOOL")
+    return()
+endif()
+
+# The library itself does not create any thread: the application provides the
+# executor with mkldnn_set_threadpool(). The threads are needed by the simple
+# executor the tests use.
+find_package(Threads REQUIRED)
+list(APPEND EXTRA_LIBS ${CMAKE_THREAD_LIBS_INIT})
+
+add_definitions(-DMKLDNN_THR=MKLDNN_THR_THREADPOOL)
+
+message(STATUS "Threading: application provided threadpool")
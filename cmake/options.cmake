@@ -47,10 +47,12 @@ option(WITH_EXAMPLE "builds examples"  ON)
 option(WITH_TEST "builds tests" ON)
 
 set(MKLDNN_THREADING "OMP" CACHE STRING
-    "specifies threading type; supports OMP (default), or TBB.
+    "specifies threading type; supports OMP (default), TBB, or THREADPOOL.
     If Intel(R) Threading Building Blocks (Intel(R) TBB) one should also
     set TBBROOT (either environement variable or CMake option) to the library
-    location")
+    location. With THREADPOOL the primitives run on an executor provided by
+    the application with mkldnn_set_threadpool() (sequentially if there is
+    none)")
 
 # =============
 # Optimizations
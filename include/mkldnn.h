@@ -449,6 +449,34 @@ mkldnn_status_t MKLDNN_API mkldnn_post_ops_get_params_eltwise(
         const_mkldnn_post_ops_t post_ops, int index, float *scale,
         mkldnn_alg_kind_t *alg, float *alpha, float *beta);
 
+/** Appends a depthwise convolution post operation to the @p post_ops: the
+ * output of the primitive is convolved channel-wise with a 3x3 kernel,
+ * padding 1 and stride @p stride (1 or 2). @p weights hold C x 3 x 3 floats
+ * (#mkldnn_goihw with dims {C, 1, 1, 3, 3}, where C is the number of
+ * output channels of the primitive) and @p bias holds C floats or is NULL.
+ * Both are read by the primitive at every execution, so they must stay
+ * valid while the primitive is used.
+ *
+ * The kind of this post operation is #mkldnn_convolution.
+ *
+ * The destination of the primitive has the spatial dimensions of the
+ * depthwise convolution output, and the intermediate result is not stored,
+ * which saves its memory traffic in inverted residual blocks:
+ * dst[] <- dw_conv ( op(...) ) // instead of dst[] <- op(...)
+ * Eltwise post operations appended before this one are applied to the
+ * intermediate result, the ones appended after it to the dst.
+ */
+mkldnn_status_t MKLDNN_API mkldnn_post_ops_append_dw_conv(
+        mkldnn_post_ops_t post_ops, int stride, const float *weights,
+        const float *bias);
+
+/** Gets the parameters of the depthwise convolution post operation with
+ * index @p index in the sequence of @p post_ops.
+ */
+mkldnn_status_t MKLDNN_API mkldnn_post_ops_get_params_dw_conv(
+        const_mkldnn_post_ops_t post_ops, int index, int *stride,
+        const float **weights, const float **bias);
+
 /** @} */
 
 /** @} */
@@ -1380,6 +1408,11 @@ mkldnn_status_t MKLDNN_API mkldnn_lrn_backward_desc_init(
  * or not. Optionally it can also perform a fused ReLU, which in case of
  * training would also require a workspace.
  *
+ * The forward pass also supports the sum post-op (with scale 1), optionally
+ * followed by the ReLU post-op, that adds the residual held by dst before
+ * the call: dst = bn(src) + dst. The sum is applied before the ReLU, the
+ * fused one too, so that a BN-Add-ReLU sequence takes a single primitive.
+ *
  * @sa mkldnn_batch_normalization_desc_t
  * @{ */
 
@@ -1725,6 +1758,31 @@ mkldnn_status_t MKLDNN_API mkldnn_stream_rerun(mkldnn_stream_t stream,
 /** Destroys an execution @p stream. */
 mkldnn_status_t MKLDNN_API mkldnn_stream_destroy(mkldnn_stream_t stream);
 
+/** Makes the primitives submitted to the @p stream run their parallel
+ * sections on @p threadpool instead of the default one set by
+ * mkldnn_set_threadpool(). The executor is copied. Passing @c NULL returns
+ * the stream to the default threadpool. Returns #mkldnn_unimplemented unless
+ * the library is built with MKLDNN_THREADING=THREADPOOL.
+ *
+ * @note
+ *     A primitive sizes its per-thread buffers by the number of threads of
+ *     the threadpool active when it is created, so @p threadpool must not
+ *     have more threads than that one. */
+mkldnn_status_t MKLDNN_API mkldnn_stream_set_threadpool(mkldnn_stream_t stream,
+        const mkldnn_threadpool_t *threadpool);
+
+/** @} */
+
+/** @addtogroup c_api_threadpool Threadpool
+ * @{ */
+
+/** Sets the default executor of the parallel sections of the primitives. The
+ * executor is copied. Passing @c NULL makes the primitives run sequentially,
+ * which is the default. Returns #mkldnn_unimplemented unless the library is
+ * built with MKLDNN_THREADING=THREADPOOL. */
+mkldnn_status_t MKLDNN_API mkldnn_set_threadpool(
+        const mkldnn_threadpool_t *threadpool);
+
 /** @} */
 
 /** @addtogroup c_api_service Service functions
@@ -1762,6 +1820,37 @@ mkldnn_status_t MKLDNN_API mkldnn_sgemm(const char *transa, const char *transb,
         const float *B, const int *ldb,
         const float *beta, float *C, const int *ldc);
 
+/** Returns in @p size the number of bytes required to store a packed copy
+ * of the matrix selected by @p identifier ("A" or "B") for a subsequent
+ * mkldnn_sgemm_compute() call with the given shapes and transposes. */
+mkldnn_status_t MKLDNN_API mkldnn_sgemm_pack_get_size(const char *identifier,
+        const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, size_t *size);
+
+/** Packs the matrix selected by @p identifier ("A" or "B") scaled by
+ * @p alpha into @p dst, which must hold at least the number of bytes returned
+ * by mkldnn_sgemm_pack_get_size(). @p src and @p ld describe the matrix as
+ * it would be passed to mkldnn_sgemm().
+ *
+ * @note
+ *      Packing once and computing many times pays off when the same
+ *      matrix (e.g. the weights) is used in many multiplications. */
+mkldnn_status_t MKLDNN_API mkldnn_sgemm_pack(const char *identifier,
+        const char *transa, const char *transb,
+        const int *M, const int *N, const int *K,
+        const float *alpha, const float *src, const int *ld, float *dst);
+
+/** SGEMM with packed operands:
+ * C := op( A )*op( B ) + beta*C,
+ * where @p transa or @p transb equal to "P" indicates that the respective
+ * matrix was packed by mkldnn_sgemm_pack() (in this case its leading
+ * dimension is ignored). The alpha scaling was applied at packing time. */
+mkldnn_status_t MKLDNN_API mkldnn_sgemm_compute(const char *transa,
+        const char *transb, const int *M, const int *N, const int *K,
+        const float *A, const int *lda,
+        const float *B, const int *ldb,
+        const float *beta, float *C, const int *ldc);
+
 /** @} */
 
 /** @} */
@@ -258,6 +258,7 @@ enum algorithm {
     algorithm_undef = mkldnn_alg_kind_undef,
     convolution_direct = mkldnn_convolution_direct,
     convolution_winograd = mkldnn_convolution_winograd,
+    convolution_fft = mkldnn_convolution_fft,
     deconvolution_direct = mkldnn_deconvolution_direct,
     deconvolution_winograd = mkldnn_deconvolution_winograd,
     eltwise_relu = mkldnn_eltwise_relu,
@@ -411,6 +412,19 @@ struct post_ops: public handle<mkldnn_post_ops_t> {
                 "could not get eltwise params");
         alg = static_cast<algorithm>(c_alg);
     }
+
+    void append_dw_conv(int stride, const float *weights, const float *bias) {
+        error::wrap_c_api(mkldnn_post_ops_append_dw_conv(get(), stride,
+                    weights, bias),
+                "could not append dw conv");
+    }
+
+    void get_params_dw_conv(int index, int &stride, const float *&weights,
+            const float *&bias) const {
+        error::wrap_c_api(mkldnn_post_ops_get_params_dw_conv(get(), index,
+                    &stride, &weights, &bias),
+                "could not get dw conv params");
+    }
 };
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -695,6 +709,8 @@ struct memory: public primitive  {
         gOIdhw16o16i = mkldnn_gOIdhw16o16i,
         gOidhw16o = mkldnn_gOidhw16o,
         gOdhwi16o = mkldnn_gOdhwi16o,
+        Goidhw8g = mkldnn_Goidhw8g,
+        Goidhw16g = mkldnn_Goidhw16g,
         ntc = mkldnn_ntc,
         tnc = mkldnn_tnc,
         ldsnc = mkldnn_ldsnc,
@@ -1265,6 +1281,25 @@ struct primitive_desc : public handle<mkldnn_primitive_desc_t> {
         return res;
     }
 
+    /// Returns the estimated execution time in seconds
+    double time_estimate() const {
+        double res;
+        error::wrap_c_api(mkldnn_primitive_desc_query(get(),
+                    mkldnn_query_time_estimate_f64, 0, &res),
+                "could not query time estimate");
+        return res;
+    }
+
+    /// Returns the memory in bytes the implementation needs on top of the
+    /// inputs and outputs, workspace included
+    ptrdiff_t memory_consumption() const {
+        ptrdiff_t res;
+        error::wrap_c_api(mkldnn_primitive_desc_query(get(),
+                    mkldnn_query_memory_consumption_s64, 0, &res),
+                "could not query memory consumption");
+        return res;
+    }
+
     /// Advances the next implementation for the given op descriptor
     ///
     /// Returns:
@@ -3416,8 +3451,28 @@ struct stream: public handle<mkldnn_stream_t> {
                 "could not rerun a stream", &c_api_error_primitive);
         return *this;
     }
+
+    /// Makes the primitives submitted to the stream run on @p threadpool
+    /// (MKLDNN_THREADING=THREADPOOL builds only).
+    ///
+    /// @param threadpool The executor, or @c nullptr for the default one.
+    /// @returns The stream.
+    stream &set_threadpool(const mkldnn_threadpool_t *threadpool) {
+        error::wrap_c_api(mkldnn_stream_set_threadpool(get(), threadpool),
+                "could not set a threadpool of a stream");
+        return *this;
+    }
 };
 
+/// Sets the default executor of the primitives
+/// (MKLDNN_THREADING=THREADPOOL builds only).
+///
+/// @param threadpool The executor, or @c nullptr to run sequentially.
+inline void set_threadpool(const mkldnn_threadpool_t *threadpool) {
+    error::wrap_c_api(mkldnn_set_threadpool(threadpool),
+            "could not set a threadpool");
+}
+
 #undef REG_QUERY_MPD
 
 /// @}
@@ -337,6 +337,8 @@ typedef enum {
     mkldnn_gOIdhw16o16i /** blocked weights format */,
     mkldnn_gOidhw16o /** blocked weights format */,
     mkldnn_gOdhwi16o /** blocked weights format */,
+    mkldnn_Goidhw8g /** blocked weights format */,
+    mkldnn_Goidhw16g /** blocked weights format */,
 
     mkldnn_wino_fmt /** Weights format used in 8bit Winograd convolution */,
 
@@ -431,6 +433,8 @@ typedef enum {
     mkldnn_convolution_direct = 1,
     /** Winograd convolution */
     mkldnn_convolution_winograd = 2,
+    /** FFT convolution */
+    mkldnn_convolution_fft = 3,
     /** Eltwise: ReLU */
     mkldnn_eltwise_relu = 8,
     /** Eltwise: hyperbolic tangent non-linearity (tanh) */
@@ -1142,8 +1146,9 @@ typedef enum {
 
     mkldnn_query_time_estimate_f64, /**< runtime estimation (seconds) */
     mkldnn_query_memory_consumption_s64, /**< memory consumption -- extra
-                                           (scratch) memory, additional to all
-                                           inputs and outputs memory (bytes) */
+                                           (scratch) memory and workspace,
+                                           additional to all other inputs and
+                                           outputs memory (bytes) */
 
     mkldnn_query_impl_info_str, /**< implementation name */
 
@@ -1200,6 +1205,29 @@ typedef struct mkldnn_stream *mkldnn_stream_t;
 /** A constant execution stream handle. */
 typedef const struct mkldnn_stream *const_mkldnn_stream_t;
 
+/** @} */
+
+/** @addtogroup c_api_types_threadpool Threadpool
+ * @{ */
+
+/** An executor provided by the application that runs the parallel sections
+ * of the primitives when the library is built with
+ * MKLDNN_THREADING=THREADPOOL. */
+typedef struct {
+    /** Opaque pointer passed back to all the functions below. */
+    void *ctx;
+    /** Returns the number of threads of the executor. */
+    int (*get_num_threads)(void *ctx);
+    /** Returns the index of the calling thread in the executor, or -1 if the
+     * calling thread does not belong to it. */
+    int (*get_thread_num)(void *ctx);
+    /** Calls @p task(@p task_arg, i) for every i in [0, @p n) on the threads
+     * of the executor, possibly including the calling one, and returns when
+     * all the calls are done. */
+    void (*schedule)(void *ctx, int n, void (*task)(void *task_arg, int i),
+            void *task_arg);
+} mkldnn_threadpool_t;
+
 /** @} */
 /** @} */
 /** @} */
@@ -86,9 +86,21 @@ struct batch_normalization_pd_t: public primitive_desc_t {
         return desc_.data_desc.dims[ndims()-1];
     }
 
+    /* relu post-op, alone or after the residual add */
     bool with_relu_post_op() const {
         const auto &p = this->attr()->post_ops_;
-        return p.len_ == 1 && p.entry_[0].is_relu(true, true);
+        return (p.len_ == 1 && p.entry_[0].is_relu(true, true))
+            || (p.len_ == 2 && p.entry_[0].is_sum()
+                    && p.entry_[1].is_relu(true, true));
+    }
+
+    /* residual add: dst = bn(src) + dst, goes before the relu (either the
+     * post-op or the fused one) */
+    bool with_sum_post_op() const {
+        const auto &p = this->attr()->post_ops_;
+        return (p.len_ == 1 && p.entry_[0].is_sum())
+            || (p.len_ == 2 && p.entry_[0].is_sum()
+                    && p.entry_[1].is_relu(true, true));
     }
 
     bool fuse_bn_relu() const
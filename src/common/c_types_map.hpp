@@ -62,6 +62,7 @@ namespace alg_kind {
     const alg_kind_t undef = mkldnn_alg_kind_undef;
     const alg_kind_t convolution_direct = mkldnn_convolution_direct;
     const alg_kind_t convolution_winograd = mkldnn_convolution_winograd;
+    const alg_kind_t convolution_fft = mkldnn_convolution_fft;
     const alg_kind_t deconvolution_direct = mkldnn_deconvolution_direct;
     const alg_kind_t deconvolution_winograd = mkldnn_deconvolution_winograd;
     const alg_kind_t eltwise_relu = mkldnn_eltwise_relu;
@@ -201,6 +202,8 @@ namespace memory_format {
     const memory_format_t gOIdhw16o16i = mkldnn_gOIdhw16o16i;
     const memory_format_t gOidhw16o = mkldnn_gOidhw16o;
     const memory_format_t gOdhwi16o = mkldnn_gOdhwi16o;
+    const memory_format_t Goidhw8g = mkldnn_Goidhw8g;
+    const memory_format_t Goidhw16g = mkldnn_Goidhw16g;
     const memory_format_t ntc = mkldnn_ntc;
     const memory_format_t tnc = mkldnn_tnc;
     const memory_format_t ldsnc = mkldnn_ldsnc;
@@ -59,6 +59,12 @@ struct deconvolution_fwd_pd_t : public primitive_desc_t {
 
     virtual int n_inputs() const override { return 2 + with_bias(); }
     virtual int n_outputs() const override { return 1; }
+
+    virtual double flops() const override {
+        return 2. * MB() * OC() * IC() / G() * KD() * KH() * KW()
+            * ID() * IH() * IW();
+    }
+
     /* Memory format Query */
     virtual status_t query(query_t what, int idx, void *result) const override {
         switch (what) {
@@ -158,6 +164,11 @@ struct deconvolution_bwd_data_pd_t : public primitive_desc_t {
     virtual int n_inputs() const override { return 2; }
     virtual int n_outputs() const override { return 1; }
 
+    virtual double flops() const override {
+        return 2. * MB() * OC() * IC() / G() * KD() * KH() * KW()
+            * ID() * IH() * IW();
+    }
+
     virtual status_t query(query_t what, int idx, void *result) const override {
         switch (what) {
         case query::deconvolution_d:
@@ -259,6 +270,11 @@ struct deconvolution_bwd_weights_pd_t : public primitive_desc_t {
     virtual int n_inputs() const override { return 2; }
     virtual int n_outputs() const override { return 1 + with_bias(); }
 
+    virtual double flops() const override {
+        return 2. * MB() * OC() * IC() / G() * KD() * KH() * KW()
+            * ID() * IH() * IW();
+    }
+
     virtual status_t query(query_t what, int idx, void *result) const override {
         switch (what) {
         case query::deconvolution_d:
@@ -141,6 +141,16 @@ struct mkldnn_engine: public mkldnn::impl::c_compatible {
      * NULL-terminated list */
     virtual const primitive_desc_create_f* get_implementation_list() const;
 
+    /** return the attainable f32 compute rate (flop/s) and memory bandwidth
+     * (bytes/s) used by the cost model of primitive descriptors, or 0 if
+     * the engine does not provide estimates */
+    virtual double flops_rate() const { return 0; }
+    virtual double bytes_rate() const { return 0; }
+
+    /** return the typical share of flops_rate() the implementation named
+     * @p impl_name reaches */
+    virtual double efficiency(const char *impl_name) const { return 1; }
+
 protected:
     mkldnn::impl::engine_kind_t kind_;
 };
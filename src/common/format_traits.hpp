@@ -195,6 +195,8 @@ DECL_TRAITS(gOIdhw16i16o, gwei, _16i16o, 6, 3);
 DECL_TRAITS(gOIdhw16o16i, gwei, _16o16i, 6, 3);
 DECL_TRAITS(gOidhw16o, gwei, _16o, 6, 3);
 DECL_TRAITS(gOdhwi16o, gwei, _16o, 6, 3);
+DECL_TRAITS(Goidhw8g, gwei, _8g, 6, 3);
+DECL_TRAITS(Goidhw16g, gwei, _16g, 6, 3);
 
 /* rnn */
 DECL_TRAITS(ntc, rnn, _, 3, 0);
@@ -57,6 +57,9 @@ struct inner_product_fwd_pd_t: public primitive_desc_t {
     virtual int n_inputs() const override { return 2 + with_bias(); }
     virtual int n_outputs() const override { return 1; }
 
+    virtual double flops() const override
+    { return 2. * MB() * OC() * IC_total(); }
+
     virtual status_t query(query_t what, int idx, void *result) const override
     {
         switch (what) {
@@ -144,6 +147,9 @@ struct inner_product_bwd_data_pd_t: public primitive_desc_t {
     virtual int n_inputs() const override { return 2; }
     virtual int n_outputs() const override { return 1; }
 
+    virtual double flops() const override
+    { return 2. * MB() * OC() * IC_total(); }
+
     virtual status_t query(query_t what, int idx, void *result) const override
     {
         switch (what) {
@@ -236,6 +242,9 @@ struct inner_product_bwd_weights_pd_t: public primitive_desc_t {
     virtual int n_inputs() const override { return 2; }
     virtual int n_outputs() const override { return 1 + with_bias(); }
 
+    virtual double flops() const override
+    { return 2. * MB() * OC() * IC_total(); }
+
     virtual status_t query(query_t what, int idx, void *result) const override
     {
         switch (what) {
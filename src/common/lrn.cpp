@@ -57,12 +57,13 @@ status_t lrn_desc_init(lrn_desc_t *lrn_desc,
     ld.lrn_beta = beta;
     ld.lrn_k = k;
 
+    const int ndims = ld.data_desc.ndims;
     bool consistency = true
-        && ld.data_desc.ndims == 4;
+        && one_of(ndims, 4, 5);
     if (ld.prop_kind == backward_data)
         consistency = consistency
-            && ld.diff_data_desc.ndims == 4
-            && array_cmp(ld.diff_data_desc.dims, ld.data_desc.dims, 4);
+            && ld.diff_data_desc.ndims == ndims
+            && array_cmp(ld.diff_data_desc.dims, ld.data_desc.dims, ndims);
     if (!consistency) return invalid_arguments;
 
     *lrn_desc = ld;
@@ -66,10 +66,14 @@ struct lrn_fwd_pd_t: public primitive_desc_t {
 
     /* common lrn aux functions */
 
+    inline bool is_3d() const { return desc_.data_desc.ndims == 5; }
     inline int MB() const { return desc_.data_desc.dims[0]; }
     inline int C() const { return desc_.data_desc.dims[1]; }
-    inline int H() const { return desc_.data_desc.dims[2]; }
-    inline int W() const { return desc_.data_desc.dims[3]; }
+    inline int D() const { return is_3d() ? desc_.data_desc.dims[2] : 1; }
+    inline int H() const { return is_3d()
+        ? desc_.data_desc.dims[3] : desc_.data_desc.dims[2]; }
+    inline int W() const { return is_3d()
+        ? desc_.data_desc.dims[4] : desc_.data_desc.dims[3]; }
 
     bool has_zero_dim_memory() const
     { return memory_desc_wrapper(desc_.data_desc).has_zero_dim(); }
@@ -121,10 +125,14 @@ struct lrn_bwd_pd_t: public primitive_desc_t {
 
     /* common lrn aux functions */
 
+    inline bool is_3d() const { return desc_.data_desc.ndims == 5; }
     inline int MB() const { return desc_.data_desc.dims[0]; }
     inline int C() const { return desc_.data_desc.dims[1]; }
-    inline int H() const { return desc_.data_desc.dims[2]; }
-    inline int W() const { return desc_.data_desc.dims[3]; }
+    inline int D() const { return is_3d() ? desc_.data_desc.dims[2] : 1; }
+    inline int H() const { return is_3d()
+        ? desc_.data_desc.dims[3] : desc_.data_desc.dims[2]; }
+    inline int W() const { return is_3d()
+        ? desc_.data_desc.dims[4] : desc_.data_desc.dims[3]; }
 
     bool has_zero_dim_memory() const
     { return memory_desc_wrapper(desc_.data_desc).has_zero_dim(); }
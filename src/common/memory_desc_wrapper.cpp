@@ -832,6 +832,26 @@ status_t fill_Goihw16g(memory_desc_t &md) {
     return fill_contiguous_blocked(md, block_dims, perm);
 }
 
+status_t fill_Goidhw8g(memory_desc_t &md) {
+    if (md.ndims != 6) return invalid_arguments;
+
+    const dims_t block_dims = {8, 1, 1, 1, 1, 1};
+    const int perm[] = {
+         0, 1, 2, 3, 4, 5,
+         6, 7, 8, 9, 10, 11};
+    return fill_contiguous_blocked(md, block_dims, perm);
+}
+
+status_t fill_Goidhw16g(memory_desc_t &md) {
+    if (md.ndims != 6) return invalid_arguments;
+
+    const dims_t block_dims = {16, 1, 1, 1, 1, 1};
+    const int perm[] = {
+         0, 1, 2, 3, 4, 5,
+         6, 7, 8, 9, 10, 11};
+    return fill_contiguous_blocked(md, block_dims, perm);
+}
+
 status_t fill_gOIhw8i16o2i(memory_desc_t &md) {
     if (md.ndims != 5) return invalid_arguments;
 
@@ -1048,6 +1068,8 @@ status_t memory_desc_wrapper::compute_blocking(memory_desc_t &memory_desc)
     case Odhwi8o: return fill_Odhwi8o(memory_desc);
     case gOidhw16o: return fill_gOidhw16o(memory_desc);
     case gOdhwi16o: return fill_gOdhwi16o(memory_desc);
+    case Goidhw8g: return fill_Goidhw8g(memory_desc);
+    case Goidhw16g: return fill_Goidhw16g(memory_desc);
     case gOdhwi8o: return fill_gOdhwi8o(memory_desc);
     case ntc: return fill_ntc(memory_desc);
     case tnc: return fill_tnc(memory_desc);
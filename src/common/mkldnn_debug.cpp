@@ -161,6 +161,8 @@ const char *mkldnn_fmt2str(mkldnn_memory_format_t v) {
     if (v == mkldnn_gOIdhw16o16i) return "gOIdhw16o16i";
     if (v == mkldnn_gOidhw16o) return "gOidhw16o";
     if (v == mkldnn_gOdhwi16o) return "gOdhwi16o";
+    if (v == mkldnn_Goidhw8g) return "Goidhw8g";
+    if (v == mkldnn_Goidhw16g) return "Goidhw16g";
     if (v == mkldnn_wino_fmt) return "wino_fmt";
     if (v == mkldnn_ldigo_p) return "ldigo_p";
     if (v == mkldnn_ldgoi_p) return "ldgoi_p";
@@ -211,6 +213,7 @@ const char *mkldnn_alg_kind2str(mkldnn_alg_kind_t v) {
     if (v == mkldnn_alg_kind_undef) return "undef";
     if (v == mkldnn_convolution_direct) return "convolution_direct";
     if (v == mkldnn_convolution_winograd) return "convolution_winograd";
+    if (v == mkldnn_convolution_fft) return "convolution_fft";
     if (v == mkldnn_eltwise_relu) return "eltwise_relu";
     if (v == mkldnn_eltwise_tanh) return "eltwise_tanh";
     if (v == mkldnn_eltwise_elu) return "eltwise_elu";
@@ -0,0 +1,130 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn.h"
+
+#include "c_types_map.hpp"
+#include "mkldnn_thread.hpp"
+#include "utils.hpp"
+
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::status;
+
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+namespace mkldnn {
+namespace impl {
+namespace threadpool_utils {
+
+namespace {
+mkldnn_threadpool_t default_threadpool;
+bool with_default_threadpool = false;
+
+/* the executor of the stream being executed by the thread */
+thread_local const mkldnn_threadpool_t *active_threadpool = nullptr;
+
+/* the task of a parallel section the thread runs */
+thread_local bool in_task = false;
+thread_local int task_ithr = 0;
+thread_local int task_nthr = 1;
+
+struct section_t {
+    const mkldnn_threadpool_t *tp;
+    void (*body)(void *, int, int);
+    void *arg;
+    int nthr;
+};
+
+void run_task(void *task_arg, int ithr) {
+    const section_t *s = (const section_t *)task_arg;
+
+    /* the executor may run several tasks on the same thread, and may run
+     * them on the calling thread too */
+    const mkldnn_threadpool_t *saved_tp = active_threadpool;
+    const bool saved_in_task = in_task;
+    const int saved_ithr = task_ithr, saved_nthr = task_nthr;
+
+    active_threadpool = s->tp;
+    in_task = true;
+    task_ithr = ithr;
+    task_nthr = s->nthr;
+
+    s->body(s->arg, ithr, s->nthr);
+
+    active_threadpool = saved_tp;
+    in_task = saved_in_task;
+    task_ithr = saved_ithr;
+    task_nthr = saved_nthr;
+}
+}
+
+const mkldnn_threadpool_t *get_active_threadpool() {
+    if (active_threadpool != nullptr) return active_threadpool;
+    return with_default_threadpool ? &default_threadpool : nullptr;
+}
+
+const mkldnn_threadpool_t *activate_threadpool(const mkldnn_threadpool_t *tp) {
+    const mkldnn_threadpool_t *prev = active_threadpool;
+    active_threadpool = tp;
+    return prev;
+}
+
+int get_thread_num() { return in_task ? task_ithr : 0; }
+
+int get_num_threads() {
+    if (in_task) return task_nthr;
+    auto tp = get_active_threadpool();
+    return tp ? tp->get_num_threads(tp->ctx) : 1;
+}
+
+bool in_parallel() {
+    if (in_task) return true;
+    auto tp = get_active_threadpool();
+    return tp != nullptr && tp->get_thread_num(tp->ctx) >= 0;
+}
+
+void parallel(int nthr, void (*body)(void *, int, int), void *arg) {
+    auto tp = get_active_threadpool();
+    section_t s = { tp, body, arg, nthr };
+    if (tp == nullptr) {
+        for (int ithr = 0; ithr < nthr; ++ithr)
+            run_task(&s, ithr);
+        return;
+    }
+    tp->schedule(tp->ctx, nthr, run_task, &s);
+}
+
+}
+}
+}
+#endif
+
+status_t mkldnn_set_threadpool(const mkldnn_threadpool_t *threadpool) {
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+    using namespace mkldnn::impl::threadpool_utils;
+    if (threadpool != nullptr && utils::any_null(threadpool->get_num_threads,
+                threadpool->get_thread_num, threadpool->schedule))
+        return invalid_arguments;
+
+    with_default_threadpool = threadpool != nullptr;
+    if (with_default_threadpool) default_threadpool = *threadpool;
+    return success;
+#else
+    UNUSED(threadpool);
+    return unimplemented;
+#endif
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -23,6 +23,7 @@
 #define MKLDNN_THR_SEQ 0
 #define MKLDNN_THR_OMP 1
 #define MKLDNN_THR_TBB 2
+#define MKLDNN_THR_THREADPOOL 3
 
 #if !defined(MKLDNN_THR)
 #define MKLDNN_THR MKLDNN_THR_SEQ
@@ -59,6 +60,67 @@ inline int mkldnn_get_thread_num()
 { return tbb::this_task_arena::current_thread_index(); }
 inline int mkldnn_in_parallel() { return 0; }
 inline void mkldnn_thr_barrier() { assert(!"no barrier in TBB"); }
+
+#elif MKLDNN_THR == MKLDNN_THR_THREADPOOL
+#include "mkldnn.h"
+#define MKLDNN_THR_SYNC 0
+
+namespace mkldnn {
+namespace impl {
+namespace threadpool_utils {
+
+/* Exported: the templates below are instantiated in the tests as well */
+
+/* The executor of the calling thread: the one of the stream being executed,
+ * if any, or the default one set by mkldnn_set_threadpool(). nullptr means
+ * sequential execution. */
+MKLDNN_API const mkldnn_threadpool_t *get_active_threadpool();
+
+/* Makes @p tp the executor of the calling thread, returns the previous one */
+MKLDNN_API const mkldnn_threadpool_t *activate_threadpool(
+        const mkldnn_threadpool_t *tp);
+
+/* The index and the number of the tasks of the parallel section the calling
+ * thread runs, 0 and the number of the threads of the executor outside */
+MKLDNN_API int get_thread_num();
+MKLDNN_API int get_num_threads();
+
+/* True within a task, and on the threads of the executor itself: a blocking
+ * schedule() from there might never return, so the parallel sections run
+ * sequentially as nested OpenMP regions do */
+MKLDNN_API bool in_parallel();
+
+/* Runs @p body(@p arg, ithr, nthr) for every ithr in [0, nthr) on the active
+ * executor */
+MKLDNN_API void parallel(int nthr, void (*body)(void *, int, int), void *arg);
+
+/* Makes the executor of a stream active for the lifetime of the object */
+struct scoped_threadpool_t {
+    scoped_threadpool_t(const mkldnn_threadpool_t *tp)
+        : active_(tp != nullptr), prev_(nullptr)
+    { if (active_) prev_ = activate_threadpool(tp); }
+    ~scoped_threadpool_t() { if (active_) activate_threadpool(prev_); }
+
+private:
+    bool active_;
+    const mkldnn_threadpool_t *prev_;
+};
+
+}
+}
+}
+
+inline int mkldnn_get_max_threads() {
+    auto tp = mkldnn::impl::threadpool_utils::get_active_threadpool();
+    return tp ? tp->get_num_threads(tp->ctx) : 1;
+}
+inline int mkldnn_get_num_threads()
+{ return mkldnn::impl::threadpool_utils::get_num_threads(); }
+inline int mkldnn_get_thread_num()
+{ return mkldnn::impl::threadpool_utils::get_thread_num(); }
+inline int mkldnn_in_parallel()
+{ return mkldnn::impl::threadpool_utils::in_parallel(); }
+inline void mkldnn_thr_barrier() { assert(!"no barrier in THREADPOOL"); }
 #endif
 
 /* MSVC still supports omp 2.0 only */
@@ -30,8 +30,16 @@
  *                                     calls for_nd
  *  - parallel_nd_in_omp(dims..., f) - queries current nthr and ithr and then
  *                                     calls for_nd (mostly for convenience)
+ *  - parallel_nd_dynamic(dims..., f) - same as parallel_nd, but the threads
+ *                                     take chunks of iterations from a shared
+ *                                     counter until the work is over. For the
+ *                                     loops which iterations take different
+ *                                     time (padding borders, tails), and for
+ *                                     the cores running at different speeds
  */
 
+#include <atomic>
+
 namespace mkldnn {
 namespace impl {
 
@@ -49,6 +57,11 @@ void parallel(int nthr, F f) {
 #elif MKLDNN_THR == MKLDNN_THR_TBB
     if (nthr == 1) { f(0, 1); return; }
     tbb::parallel_for(0, nthr, [&](int ithr) { f(ithr, nthr); });
+#elif MKLDNN_THR == MKLDNN_THR_THREADPOOL
+    if (nthr == 1 || mkldnn_in_parallel()) { f(0, 1); return; }
+    threadpool_utils::parallel(nthr, [](void *arg, int ithr, int nthr) {
+        (*(F *)arg)(ithr, nthr);
+    }, &f);
 #endif
 }
 
@@ -145,7 +158,7 @@ void for_nd(const int ithr, const int nthr, const T0 &D0, const T1 &D1,
 
 /* parallel_nd and parallel_nd_in_omp section */
 
-#if MKLDNN_THR != MKLDNN_THR_TBB
+#if MKLDNN_THR == MKLDNN_THR_SEQ || MKLDNN_THR == MKLDNN_THR_OMP
 template <typename ...Args>
 void parallel_nd(Args &&...args) {
 #if MKLDNN_THR == MKLDNN_THR_SEQ
@@ -156,39 +169,35 @@ void parallel_nd(Args &&...args) {
             utils::forward<Args>(args)...);
 #endif
 }
-#else // MKLDNN_THR != MKLDNN_THR_TBB
+#else // MKLDNN_THR == MKLDNN_THR_SEQ || MKLDNN_THR == MKLDNN_THR_OMP
 
 // gcc 4.8 has a bug with passing parameter pack to lambdas.
 // So have to explicitly instantiate all the cases.
 
 template <typename T0, typename F>
 void parallel_nd(const T0 &D0, F f) {
-    const int nthr = mkldnn_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+    parallel(0, [&](int ithr, int nthr) {
         for_nd(ithr, nthr, D0, f);
     });
 }
 
 template <typename T0, typename T1, typename F>
 void parallel_nd(const T0 &D0, const T1 &D1, F f) {
-    const int nthr = mkldnn_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+    parallel(0, [&](int ithr, int nthr) {
         for_nd(ithr, nthr, D0, D1, f);
     });
 }
 
 template <typename T0, typename T1, typename T2, typename F>
 void parallel_nd(const T0 &D0, const T1 &D1, const T2 &D2, F f) {
-    const int nthr = mkldnn_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+    parallel(0, [&](int ithr, int nthr) {
         for_nd(ithr, nthr, D0, D1, D2, f);
     });
 }
 
 template <typename T0, typename T1, typename T2, typename T3, typename F>
 void parallel_nd(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3, F f) {
-    const int nthr = mkldnn_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+    parallel(0, [&](int ithr, int nthr) {
         for_nd(ithr, nthr, D0, D1, D2, D3, f);
     });
 }
@@ -197,8 +206,7 @@ template <typename T0, typename T1, typename T2, typename T3, typename T4,
          typename F>
 void parallel_nd(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3,
         const T4 &D4, F f) {
-    const int nthr = mkldnn_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+    parallel(0, [&](int ithr, int nthr) {
         for_nd(ithr, nthr, D0, D1, D2, D3, D4, f);
     });
 }
@@ -207,8 +215,7 @@ template <typename T0, typename T1, typename T2, typename T3, typename T4,
          typename T5, typename F>
 void parallel_nd(const T0 &D0, const T1 &D1, const T2 &D2, const T3 &D3,
         const T4 &D4, const T5 &D5, F f) {
-    const int nthr = mkldnn_get_max_threads();
-    tbb::parallel_for(0, nthr, [&](int ithr) {
+    parallel(0, [&](int ithr, int nthr) {
         for_nd(ithr, nthr, D0, D1, D2, D3, D4, D5, f);
     });
 }
@@ -223,9 +230,116 @@ void parallel_nd_in_omp(Args &&...args) {
             utils::forward<Args>(args)...);
 #elif MKLDNN_THR == MKLDNN_THR_TBB
     assert(!"unsupported parallel_nd_in_omp()");
+#elif MKLDNN_THR == MKLDNN_THR_THREADPOOL
+    for_nd(mkldnn_get_thread_num(), mkldnn_get_num_threads(),
+            utils::forward<Args>(args)...);
 #endif
 }
 
+/* parallel_nd_dynamic section */
+
+/* Calls f(start, end) for the consecutive chunks of [0, work_amount) taken by
+ * the threads from a shared counter. A thread gets about 1/16 of its static
+ * share at a time: small enough for a slow thread to leave the rest of its
+ * share to the others, large enough to keep the counter uncontended. */
+template <typename F>
+void parallel_dynamic(size_t work_amount, F f) {
+    if (work_amount == 0) return;
+    const int nthr = mkldnn_in_parallel() ? 1 : mkldnn_get_max_threads();
+    if (nthr == 1 || work_amount == 1) { f((size_t)0, work_amount); return; }
+
+    enum { chunks_per_thr = 16 };
+    size_t chunk = work_amount / ((size_t)nthr * chunks_per_thr);
+    if (chunk == 0) chunk = 1;
+    std::atomic<size_t> next(0);
+    parallel(nthr, [&](int, int) {
+        for (size_t start = next.fetch_add(chunk); start < work_amount;
+                start = next.fetch_add(chunk))
+            f(start, start + chunk < work_amount
+                    ? start + chunk : work_amount);
+    });
+}
+
+template <typename T0, typename F>
+void parallel_nd_dynamic(const T0 &D0, F f) {
+    parallel_dynamic((size_t)D0, [&](size_t start, size_t end) {
+        for (size_t d0 = start; d0 < end; ++d0) f((T0)d0);
+    });
+}
+
+template <typename T0, typename T1, typename F>
+void parallel_nd_dynamic(const T0 &D0, const T1 &D1, F f) {
+    const size_t work_amount = (size_t)D0 * D1;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0{0}; T1 d1{0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1);
+            utils::nd_iterator_step(d0, D0, d1, D1);
+        }
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename F>
+void parallel_nd_dynamic(const T0 &D0, const T1 &D1, const T2 &D2, F f) {
+    const size_t work_amount = (size_t)D0 * D1 * D2;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0{0}; T1 d1{0}; T2 d2{0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2);
+        }
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename F>
+void parallel_nd_dynamic(const T0 &D0, const T1 &D1, const T2 &D2,
+        const T3 &D3, F f) {
+    const size_t work_amount = (size_t)D0 * D1 * D2 * D3;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0{0}; T1 d1{0}; T2 d2{0}; T3 d3{0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3);
+        }
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+         typename F>
+void parallel_nd_dynamic(const T0 &D0, const T1 &D1, const T2 &D2,
+        const T3 &D3, const T4 &D4, F f) {
+    const size_t work_amount = (size_t)D0 * D1 * D2 * D3 * D4;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0{0}; T1 d1{0}; T2 d2{0}; T3 d3{0}; T4 d4{0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3,
+                d4, D4);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3, d4);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3, d4, D4);
+        }
+    });
+}
+
+template <typename T0, typename T1, typename T2, typename T3, typename T4,
+         typename T5, typename F>
+void parallel_nd_dynamic(const T0 &D0, const T1 &D1, const T2 &D2,
+        const T3 &D3, const T4 &D4, const T5 &D5, F f) {
+    const size_t work_amount = (size_t)D0 * D1 * D2 * D3 * D4 * D5;
+    parallel_dynamic(work_amount, [&](size_t start, size_t end) {
+        T0 d0{0}; T1 d1{0}; T2 d2{0}; T3 d3{0}; T4 d4{0}; T5 d5{0};
+        utils::nd_iterator_init(start, d0, D0, d1, D1, d2, D2, d3, D3, d4, D4,
+                d5, D5);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            f(d0, d1, d2, d3, d4, d5);
+            utils::nd_iterator_step(d0, D0, d1, D1, d2, D2, d3, D3, d4, D4,
+                    d5, D5);
+        }
+    });
+}
+
 } // namespace impl
 } // namespace mkldnn
 
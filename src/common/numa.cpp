@@ -0,0 +1,195 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+#include "numa.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+#if defined(__linux__) && MKLDNN_THR == MKLDNN_THR_OMP
+#define MKLDNN_NUMA_SUPPORTED
+#endif
+
+namespace mkldnn {
+namespace impl {
+
+namespace {
+enum { max_nodes = 64, page = 4096 };
+
+#ifdef MKLDNN_NUMA_SUPPORTED
+cpu_set_t node_cpus[max_nodes];
+
+/* parses a sysfs cpu list such as "0-27,56-83" */
+bool read_node_cpus(int node, cpu_set_t &set) {
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist",
+            node);
+    FILE *f = fopen(path, "r");
+    if (f == nullptr) return false;
+    char list[4096] = {0};
+    const bool ok = fgets(list, sizeof(list), f) != nullptr;
+    fclose(f);
+    if (!ok) return false;
+
+    CPU_ZERO(&set);
+    for (char *p = list; *p != '\0' && *p != '\n';) {
+        char *end;
+        const long first = strtol(p, &end, 10);
+        if (end == p) break;
+        long last = first;
+        if (*end == '-') last = strtol(end + 1, &end, 10);
+        for (long c = first; c <= last && c < CPU_SETSIZE; ++c)
+            CPU_SET((int)c, &set);
+        p = *end == ',' ? end + 1 : end;
+    }
+    return CPU_COUNT(&set) > 0;
+}
+
+int init_nodes() {
+    int n = 0;
+    while (n < max_nodes && read_node_cpus(n, node_cpus[n])) ++n;
+    return nstl::max(n, 1);
+}
+
+/* the node of the team thread ithr belongs to */
+int thread_node(int ithr, int nthr, int nnodes) {
+    return (int)((size_t)ithr * nnodes / nthr);
+}
+
+/* copies its own part of a buffer first touched by the same split on every
+ * thread and reports the bandwidth achieved by each node */
+void report_bandwidth(int nnodes) {
+    const int nthr = mkldnn_get_max_threads();
+    /* well beyond the last level caches of the nodes */
+    const size_t size = (size_t)256 << 20;
+    char *src = (char *)malloc(size, page);
+    char *dst = (char *)malloc(size, page);
+    double *thr_ms = (double *)malloc(sizeof(double) * nthr, 64);
+    if (src != nullptr && dst != nullptr && thr_ms != nullptr) {
+        numa_first_touch(src, size);
+        numa_first_touch(dst, size);
+        double node_ms[max_nodes] = {0};
+        size_t node_bytes[max_nodes] = {0};
+        for (int r = 0; r < 3; ++r) {
+            parallel(nthr, [&](const int ithr, const int nthr) {
+                size_t start{0}, end{0};
+                balance211(size / page, nthr, ithr, start, end);
+                double ms = get_msec();
+                memcpy(dst + page * start, src + page * start,
+                        page * (end - start));
+                thr_ms[ithr] = get_msec() - ms;
+            });
+            for (int n = 0; n < nnodes; ++n) {
+                double ms = 0;
+                size_t bytes = 0;
+                for (int ithr = 0; ithr < nthr; ++ithr) {
+                    if (thread_node(ithr, nthr, nnodes) != n) continue;
+                    size_t start{0}, end{0};
+                    balance211(size / page, nthr, ithr, start, end);
+                    ms = nstl::max(ms, thr_ms[ithr]);
+                    bytes += 2 * page * (end - start);
+                }
+                if (r == 0 || ms < node_ms[n]) node_ms[n] = ms;
+                node_bytes[n] = bytes;
+            }
+        }
+        for (int n = 0; n < nnodes; ++n)
+            printf("mkldnn_verbose,info,numa,node:%d,bandwidth:%gGB/s\n", n,
+                    1e-6 * node_bytes[n] / nstl::max(node_ms[n], 1e-3));
+        fflush(0);
+    }
+    free(src); free(dst); free(thr_ms);
+}
+#endif
+}
+
+bool mkldnn_numa() {
+#ifdef MKLDNN_NUMA_SUPPORTED
+    static int enabled = -1;
+    if (enabled == -1) {
+        const int len = 2;
+        char val[len] = {0};
+        enabled = mkldnn_getenv(val, "MKLDNN_NUMA", len) == 1
+            && atoi(val) == 1;
+    }
+    return enabled == 1;
+#else
+    return false;
+#endif
+}
+
+int numa_nodes() {
+#ifdef MKLDNN_NUMA_SUPPORTED
+    static const int nnodes = init_nodes();
+    return nnodes;
+#else
+    return 1;
+#endif
+}
+
+void numa_bind_threads() {
+#ifdef MKLDNN_NUMA_SUPPORTED
+    static bool bound = false;
+    if (bound || !mkldnn_numa()) return;
+    bound = true;
+
+    const int nnodes = numa_nodes();
+    const int nthr = mkldnn_get_max_threads();
+    if (nnodes > 1 && nthr >= nnodes) {
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            const int node = thread_node(ithr, nthr, nnodes);
+            sched_setaffinity(0, sizeof(cpu_set_t), &node_cpus[node]);
+        });
+    }
+
+    if (mkldnn_verbose()->level) {
+        printf("mkldnn_verbose,info,numa,nodes:%d,threads:%d\n", nnodes,
+                nthr);
+        report_bandwidth(nnodes);
+    }
+#endif
+}
+
+void numa_first_touch(void *ptr, size_t size) {
+    if (!mkldnn_numa() || ptr == nullptr) return;
+    if (mkldnn_in_parallel()) {
+        memset(ptr, 0, size);
+        return;
+    }
+    char *p = (char *)ptr;
+    const size_t npages = utils::div_up(size, (size_t)page);
+    parallel(0, [&](const int ithr, const int nthr) {
+        size_t start{0}, end{0};
+        balance211(npages, nthr, ithr, start, end);
+        const size_t last = nstl::min(page * end, size);
+        if (page * start < last)
+            memset(p + page * start, 0, last - page * start);
+    });
+}
+
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,50 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef NUMA_HPP
+#define NUMA_HPP
+
+#include <stddef.h>
+
+namespace mkldnn {
+namespace impl {
+
+/* NUMA aware execution (MKLDNN_NUMA=1, Linux with OpenMP only)
+ *
+ * The threads of the library are split into contiguous teams, one per NUMA
+ * node, and each team is bound to the cpus of its node. As the work of a
+ * primitive is split between the threads with balance211(), which gives
+ * contiguous chunks to consecutive threads, every node then works on its own
+ * part of the data (usually a range of the minibatch). The scratch buffers
+ * of the library are first touched by the threads that use them, so that
+ * their pages are allocated on the right node. */
+bool mkldnn_numa();
+
+/* The number of NUMA nodes of the system, 1 if unknown */
+int numa_nodes();
+
+/* Binds the threads to the nodes, once per process; a no-op unless
+ * mkldnn_numa() */
+void numa_bind_threads();
+
+/* Zeroes the buffer page by page in parallel with the same split of the
+ * threads as balance211(); a no-op unless mkldnn_numa() */
+void numa_first_touch(void *ptr, size_t size);
+
+}
+}
+
+#endif
@@ -87,6 +87,24 @@ status_t post_ops_t::append_eltwise(float scale, alg_kind_t alg, float alpha,
     return success;
 }
 
+status_t post_ops_t::append_dw_conv(int stride, const float *weights,
+        const float *bias) {
+    if (!one_of(stride, 1, 2) || weights == nullptr)
+        return invalid_arguments;
+
+    if (len_ == capacity)
+        return out_of_memory;
+
+    entry_[len_].kind = primitive_kind::convolution;
+    entry_[len_].dw_conv.stride = stride;
+    entry_[len_].dw_conv.weights = weights;
+    entry_[len_].dw_conv.bias = bias;
+
+    len_++;
+
+    return success;
+}
+
 status_t primitive_attr_t::set_round_mode(round_mode_t round_mode) {
     using namespace mkldnn::impl::round_mode;
 
@@ -270,3 +288,27 @@ status_t mkldnn_post_ops_get_params_eltwise(const post_ops_t *post_ops,
 
     return success;
 }
+
+status_t mkldnn_post_ops_append_dw_conv(post_ops_t *post_ops, int stride,
+        const float *weights, const float *bias) {
+    if (post_ops == nullptr)
+        return invalid_arguments;
+
+    return post_ops->append_dw_conv(stride, weights, bias);
+}
+
+status_t mkldnn_post_ops_get_params_dw_conv(const post_ops_t *post_ops,
+        int index, int *stride, const float **weights, const float **bias) {
+    bool ok = true
+        && simple_get_params_check(post_ops, index, primitive_kind::convolution)
+        && !any_null(stride, weights, bias);
+    if (!ok)
+        return invalid_arguments;
+
+    const auto &e = post_ops->entry_[index].dw_conv;
+    *stride = e.stride;
+    *weights = e.weights;
+    *bias = e.bias;
+
+    return success;
+}
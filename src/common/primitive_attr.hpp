@@ -84,6 +84,10 @@ struct mkldnn_post_ops: public mkldnn::impl::c_compatible {
                 mkldnn::impl::alg_kind_t alg;
                 float scale, alpha, beta;
             } eltwise;
+            struct {
+                int stride;
+                const float *weights, *bias;
+            } dw_conv;
         };
 
         bool is_relu(bool require_scale_one = true,
@@ -99,6 +103,10 @@ struct mkldnn_post_ops: public mkldnn::impl::c_compatible {
             return kind == primitive_kind::sum
                 && utils::implication(require_scale_one, sum.scale == 1.f);
         }
+        bool is_dw_conv() const {
+            using namespace mkldnn::impl;
+            return kind == primitive_kind::convolution;
+        }
     };
 
     mkldnn_post_ops(): len_(0) {}
@@ -106,6 +114,8 @@ struct mkldnn_post_ops: public mkldnn::impl::c_compatible {
     mkldnn::impl::status_t append_sum(float scale);
     mkldnn::impl::status_t append_eltwise(float scale,
             mkldnn::impl::alg_kind_t alg, float alpha, float beta);
+    mkldnn::impl::status_t append_dw_conv(int stride, const float *weights,
+            const float *bias);
 
     int find(mkldnn::impl::primitive_kind_t kind, int start = 0,
             int stop = -1) const {
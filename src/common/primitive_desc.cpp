@@ -17,6 +17,7 @@
 #include "mkldnn.h"
 
 #include "c_types_map.hpp"
+#include "engine.hpp"
 #include "nstl.hpp"
 #include "primitive_desc.hpp"
 #include "memory_pd.hpp"
@@ -24,6 +25,24 @@
 using namespace mkldnn::impl;
 using namespace mkldnn::impl::status;
 
+double primitive_desc_t::efficiency() const
+{ return engine()->efficiency(name()); }
+
+double primitive_desc_t::time_estimate() const {
+    const double flops_rate = engine()->flops_rate();
+    const double bytes_rate = engine()->bytes_rate();
+    if (flops_rate <= 0 || bytes_rate <= 0) return 0;
+
+    double bytes = (double)scratchpad_size();
+    for (int i = 0; i < n_inputs(); ++i)
+        if (input_pd(i)) bytes += input_pd(i)->get_size();
+    for (int i = 0; i < n_outputs(); ++i)
+        if (output_pd(i)) bytes += output_pd(i)->get_size();
+
+    return nstl::max(flops() / (flops_rate * efficiency()),
+            bytes / bytes_rate);
+}
+
 status_t primitive_desc_t::query(query_t what, int idx, void *result) const {
     auto safe_ret_pd = [&](const memory_pd_t *_) {
         if (_ == nullptr) return not_required;
@@ -55,6 +74,17 @@ status_t primitive_desc_t::query(query_t what, int idx, void *result) const {
         case query::num_of_inputs_s32: *(int*)result = n_inputs(); break;
         case query::num_of_outputs_s32: *(int*)result = n_outputs(); break;
 
+        case query::time_estimate_f64: {
+            const double t = time_estimate();
+            if (t <= 0) return unimplemented;
+            *(double *)result = t;
+            break;
+        }
+        case query::memory_consumption_s64:
+            *(ptrdiff_t *)result = (ptrdiff_t)(scratchpad_size()
+                    + (workspace_pd() ? workspace_pd()->get_size() : 0));
+            break;
+
         case query::impl_info_str: *(const char **)result = name(); break;
 
         default: return unimplemented;
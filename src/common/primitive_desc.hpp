@@ -62,6 +62,19 @@ struct mkldnn_primitive_desc: public mkldnn::impl::c_compatible {
     virtual int n_inputs() const { return 0; }
     virtual int n_outputs() const { return 0; }
 
+    /* cost model behind query::time_estimate_f64 and
+     * query::memory_consumption_s64: the arithmetic operations of the
+     * problem, the share of the engine peak rate the implementation reaches
+     * on them, and the memory it allocates on top of the inputs and outputs
+     * (workspace aside) */
+    virtual double flops() const { return 0; }
+    virtual double efficiency() const;
+    virtual size_t scratchpad_size() const { return 0; }
+
+    /* max of the compute and the memory traffic times, in seconds; 0 if the
+     * engine provides no rates */
+    double time_estimate() const;
+
     virtual mkldnn::impl::status_t query(mkldnn::impl::query_t what, int idx,
             void *result) const;
 
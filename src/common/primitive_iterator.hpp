@@ -21,6 +21,7 @@
 #include "c_types_map.hpp"
 #include "engine.hpp"
 #include "primitive_desc.hpp"
+#include "tuning.hpp"
 #include "type_helpers.hpp"
 
 struct mkldnn_primitive_desc_iterator: public mkldnn::impl::c_compatible {
@@ -31,8 +32,11 @@ struct mkldnn_primitive_desc_iterator: public mkldnn::impl::c_compatible {
         : idx_(-1), engine_(engine), pd_(nullptr), op_desc_(op_desc)
         , attr_(attr ? *attr : mkldnn::impl::primitive_attr_t()), hint_fwd_pd_(hint_fwd_pd)
         , impl_list_(engine_->get_implementation_list()), last_idx_(0)
+        , pos_(-1), tuned_idx_(-1)
     {
         while (impl_list_[last_idx_] != nullptr) ++last_idx_;
+        tuned_idx_ = mkldnn::impl::tuned_impl_idx(engine_, op_desc_, &attr_,
+                hint_fwd_pd_);
     }
     ~mkldnn_primitive_desc_iterator() { if (pd_) delete pd_; }
 
@@ -46,11 +50,13 @@ struct mkldnn_primitive_desc_iterator: public mkldnn::impl::c_compatible {
 
     mkldnn::impl::primitive_desc_iterator_t &operator++() {
         if (pd_) { delete pd_; pd_ = nullptr; }
-        while (++idx_ != last_idx_) {
+        while (++pos_ != last_idx_) {
+            idx_ = impl_idx(pos_);
             auto s = impl_list_[idx_](&pd_, op_desc_, &attr_, engine_,
                     hint_fwd_pd_);
-            if (s ==  mkldnn::impl::status::success) break;
+            if (s ==  mkldnn::impl::status::success) return *this;
         }
+        idx_ = last_idx_;
         return *this;
     }
 
@@ -68,12 +74,22 @@ protected:
     const mkldnn::impl::primitive_desc_t *hint_fwd_pd_;
     const pd_create_f *impl_list_;
     int last_idx_;
+    int pos_, tuned_idx_;
+
+    /* the tuned implementation (if any) goes first, the rest keep the
+     * order of the engine list */
+    int impl_idx(int pos) const {
+        if (tuned_idx_ < 0) return pos;
+        if (pos == 0) return tuned_idx_;
+        return pos <= tuned_idx_ ? pos - 1 : pos;
+    }
 
 private:
     mkldnn_primitive_desc_iterator(mkldnn::impl::engine_t *engine, int last_idx)
         : idx_(last_idx), engine_(engine), pd_(nullptr)
         , op_desc_(nullptr), hint_fwd_pd_(nullptr)
-        , impl_list_(nullptr), last_idx_(last_idx) {}
+        , impl_list_(nullptr), last_idx_(last_idx), pos_(last_idx)
+        , tuned_idx_(-1) {}
 };
 
 #endif
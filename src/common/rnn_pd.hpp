@@ -62,6 +62,13 @@ struct rnn_pd_t : public primitive_desc_t {
                 prop_kind::forward_inference);
     }
 
+    /* the gemms of the cells; backward computes both the data and the
+     * weights gradients */
+    virtual double flops() const override {
+        return (is_fwd() ? 2. : 4.) * L() * D() * T() * MB() * G() * DIC()
+            * (SLC() + SIC());
+    }
+
     inline size_t ws_states_size() {
         return (size_t)(L() + 1) * D() * (T() + 1) * S() * MB() * S_GLD();
     }
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include "mkldnn_thread.hpp"
+#include "numa.hpp"
 #include "utils.hpp"
 
 #include "scratchpad.hpp"
@@ -34,6 +35,7 @@ struct concurent_scratchpad_t : public scratchpad_t {
         size_ = size;
         scratchpad_ = (char *) malloc(size, page_size);
         assert(scratchpad_ != nullptr);
+        numa_first_touch(scratchpad_, size_);
     }
 
     ~concurent_scratchpad_t() {
@@ -61,6 +63,7 @@ struct global_scratchpad_t : public scratchpad_t {
             size_ = size;
             scratchpad_ = (char *) malloc(size, page_size);
             assert(scratchpad_ != nullptr);
+            numa_first_touch(scratchpad_, size_);
         }
         reference_count_++;
     }
@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "mkldnn_thread.hpp"
 #include "nstl.hpp"
 #include "stream.hpp"
 #include "type_helpers.hpp"
@@ -27,6 +28,13 @@
 using namespace mkldnn::impl;
 using namespace mkldnn::impl::status;
 
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+#define THREADPOOL_SCOPE() \
+    threadpool_utils::scoped_threadpool_t scoped_threadpool(threadpool())
+#else
+#define THREADPOOL_SCOPE()
+#endif
+
 status_t stream_t::submit(const nstl::vector<primitive_t *> &prims,
         primitive_t **error_prim) {
     if (!modifiable_) return invalid_arguments;
@@ -46,6 +54,7 @@ status_t stream_t::submit(const nstl::vector<primitive_t *> &prims,
 
     const size_t start = stream_.size();
     stream_.insert(stream_.end(), prims.begin(), prims.end());
+    THREADPOOL_SCOPE();
     return submit_impl(start, stream_.size(), error_prim);
 }
 
@@ -61,6 +70,7 @@ status_t stream_t::wait(primitive_t **error_prim) {
 
     modifiable_ = false;
     state_ = stream_t::waiting;
+    THREADPOOL_SCOPE();
     status_t status = wait_impl(error_prim);
     state_ = stream_t::stopped;
     return status;
@@ -73,6 +83,7 @@ status_t stream_t::rerun(primitive_t **error_prim) {
     if (error_prim == nullptr) error_prim = &error_primitive_stub;
 
     state_ = stream_t::running;
+    THREADPOOL_SCOPE();
     return rerun_impl(error_prim);
 }
 
@@ -117,6 +128,21 @@ status_t mkldnn_stream_rerun(stream_t *stream, primitive_t **error_primitive) {
     return stream->rerun(error_primitive);
 }
 
+status_t mkldnn_stream_set_threadpool(stream_t *stream,
+        const mkldnn_threadpool_t *threadpool) {
+#if MKLDNN_THR == MKLDNN_THR_THREADPOOL
+    if (stream == nullptr) return invalid_arguments;
+    if (threadpool != nullptr && utils::any_null(threadpool->get_num_threads,
+                threadpool->get_thread_num, threadpool->schedule))
+        return invalid_arguments;
+    stream->set_threadpool(threadpool);
+    return success;
+#else
+    UNUSED(stream); UNUSED(threadpool);
+    return unimplemented;
+#endif
+}
+
 status_t mkldnn_stream_destroy(stream_t *stream) {
     if (stream) delete stream;
     return success;
@@ -72,7 +72,8 @@ struct mkldnn_stream: public mkldnn::impl::c_compatible {
 #endif
     };
 
-    mkldnn_stream(): modifiable_(true), state_(mkldnn_stream::running) {}
+    mkldnn_stream(): modifiable_(true), state_(mkldnn_stream::running)
+        , with_threadpool_(false), threadpool_() {}
     virtual ~mkldnn_stream() {}
 
     /** submits vector of primitives @p prims to a stream
@@ -154,9 +155,22 @@ struct mkldnn_stream: public mkldnn::impl::c_compatible {
     virtual mkldnn::impl::status_t rerun_impl(
             mkldnn::impl::primitive_t **error_prim) = 0;
 
+    /** makes the primitives of the stream run on @p threadpool, or on the
+     * default executor if it is @c nullptr */
+    void set_threadpool(const mkldnn_threadpool_t *threadpool) {
+        with_threadpool_ = threadpool != nullptr;
+        if (with_threadpool_) threadpool_ = *threadpool;
+    }
+
+    /** returns the executor of the stream, @c nullptr for the default one */
+    const mkldnn_threadpool_t *threadpool() const
+    { return with_threadpool_ ? &threadpool_ : nullptr; }
+
 protected:
     bool modifiable_;
     state_t state_;
+    bool with_threadpool_;
+    mkldnn_threadpool_t threadpool_;
 
     primitive_vector stream_;
 };
@@ -0,0 +1,295 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "mkldnn.h"
+#include "mkldnn_debug.h"
+
+#include "c_types_map.hpp"
+#include "engine.hpp"
+#include "memory_pd.hpp"
+#include "mkldnn_thread.hpp"
+#include "primitive.hpp"
+#include "primitive_desc.hpp"
+#include "tuning.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+namespace {
+
+enum { max_candidates = 32, max_path_len = 1024 };
+
+bool tuning_enabled = false;
+char db_path[max_path_len] = {0};
+
+std::recursive_mutex db_mutex;
+std::map<std::string, std::string> db;
+bool db_loaded = false;
+
+/* the tuning database is a text file with one "key impl_name" line per
+ * problem; later lines win */
+void load_db() {
+    db_loaded = true;
+    if (db_path[0] == '\0') return;
+    FILE *f = mkldnn_fopen(db_path, "r");
+    if (f == nullptr) return;
+    char line[4096];
+    while (fgets(line, sizeof(line), f)) {
+        char *sep = strrchr(line, ' ');
+        if (sep == nullptr) continue;
+        *sep = '\0';
+        char *name = sep + 1;
+        name[strcspn(name, "\r\n")] = '\0';
+        if (line[0] != '\0' && name[0] != '\0') db[line] = name;
+    }
+    fclose(f);
+}
+
+void store_db(const std::string &key, const char *name) {
+    db[key] = name;
+    if (db_path[0] == '\0') return;
+    FILE *f = mkldnn_fopen(db_path, "a");
+    if (f == nullptr) return;
+    fprintf(f, "%s %s\n", key.c_str(), name);
+    fclose(f);
+}
+
+void md2str(std::string &s, const memory_desc_t &md) {
+    s += ',';
+    if (md.ndims == 0) { s += '-'; return; }
+    s += mkldnn_dt2str(md.data_type);
+    s += ':';
+    s += mkldnn_fmt2str(md.format);
+    for (int d = 0; d < md.ndims; ++d) {
+        s += d ? 'x' : ':';
+        s += std::to_string(md.dims[d]);
+    }
+}
+
+void dims2str(std::string &s, char prefix, const dims_t dims, int n) {
+    s += ',';
+    s += prefix;
+    for (int d = 0; d < n; ++d) {
+        if (d) s += 'x';
+        s += std::to_string(dims[d]);
+    }
+}
+
+/* The problem as given by the user, the attributes, the number of threads
+ * and the names of the viable implementations: the latter stand for the
+ * instruction set, as the jit implementations are named after it, and make
+ * a database entry go stale when the set of candidates changes */
+std::string make_key(const op_desc_t *op_desc, const primitive_attr_t *attr,
+        const primitive_desc_t **cands, int ncands) {
+    const convolution_desc_t &cd = op_desc->kind == primitive_kind::convolution_relu
+        ? op_desc->convolution_relu.convolution_desc : op_desc->convolution;
+    const int nsp = nstl::max(0, cd.src_desc.ndims - 2)
+        + nstl::max(0, cd.diff_src_desc.ndims - 2);
+
+    std::string s = mkldnn_prim_kind2str(op_desc->kind);
+    s += ',';
+    s += mkldnn_prop_kind2str(cd.prop_kind);
+    s += ',';
+    s += mkldnn_alg_kind2str(cd.alg_kind);
+    md2str(s, cd.src_desc);
+    md2str(s, cd.diff_src_desc);
+    md2str(s, cd.weights_desc);
+    md2str(s, cd.diff_weights_desc);
+    md2str(s, cd.bias_desc);
+    md2str(s, cd.diff_bias_desc);
+    md2str(s, cd.dst_desc);
+    md2str(s, cd.diff_dst_desc);
+    dims2str(s, 's', cd.strides, nsp);
+    dims2str(s, 'd', cd.dilates, nsp);
+    dims2str(s, 'l', cd.padding[0], nsp);
+    dims2str(s, 'r', cd.padding[1], nsp);
+    if (op_desc->kind == primitive_kind::convolution_relu)
+        s += ",relu";
+
+    s += ",po:";
+    const auto &po = attr->post_ops_;
+    for (int i = 0; i < po.len_; ++i) {
+        if (i) s += '+';
+        const auto &e = po.entry_[i];
+        s += e.kind == primitive_kind::eltwise
+            ? mkldnn_alg_kind2str(e.eltwise.alg)
+            : mkldnn_prim_kind2str(e.kind);
+    }
+    s += ",oscale:" + std::to_string(attr->output_scales_.mask_);
+
+    s += ",nthr:" + std::to_string(mkldnn_get_max_threads());
+    s += ",impls:";
+    for (int c = 0; c < ncands; ++c) {
+        if (c) s += '|';
+        s += cands[c]->name();
+    }
+
+    for (auto &ch: s) if (ch == ' ') ch = '_';
+    return s;
+}
+
+/* the best of a few runs on zero filled buffers, or -1 if the primitive
+ * cannot be created */
+double time_impl(const primitive_desc_t *pd) {
+    const int n_in = pd->n_inputs(), n_out = pd->n_outputs();
+    const int n_mem = n_in + n_out;
+    if (n_mem > 8) return -1;
+
+    primitive_t *mem[8] = {nullptr};
+    void *buf[8] = {nullptr};
+    primitive_at_t inputs[8];
+    const primitive_t *outputs[8];
+
+    bool ok = true;
+    for (int i = 0; i < n_mem && ok; ++i) {
+        const memory_pd_t *mpd = i < n_in
+            ? pd->input_pd(i) : pd->output_pd(i - n_in);
+        ok = mpd != nullptr
+            && mpd->create_primitive(&mem[i], nullptr, nullptr)
+                == status::success;
+        if (!ok) break;
+        const size_t size = nstl::max(mpd->get_size(), (size_t)1);
+        buf[i] = malloc(size, 64);
+        ok = buf[i] != nullptr;
+        if (!ok) break;
+        memset(buf[i], 0, size);
+        mem[i]->set_data_handle(buf[i]);
+        if (i < n_in) inputs[i] = { mem[i], 0 };
+        else outputs[i - n_in] = mem[i];
+    }
+
+    double best = -1;
+    primitive_t *p = nullptr;
+    if (ok && pd->create_primitive(&p, inputs, outputs) == status::success) {
+        event_t e;
+        p->execute(&e); /* warm up */
+
+        const int max_runs = 5;
+        const double max_ms = 1000;
+        double total = 0;
+        for (int r = 0; r < max_runs && total < max_ms; ++r) {
+            e.reset();
+            double ms = get_msec();
+            p->execute(&e);
+            ms = get_msec() - ms;
+            total += ms;
+            if (best < 0 || ms < best) best = ms;
+        }
+        delete p;
+    }
+
+    for (int i = 0; i < n_mem; ++i) {
+        delete mem[i];
+        free(buf[i]);
+    }
+    return best;
+}
+
+}
+
+bool mkldnn_tuning() {
+    static bool initialized = false;
+    if (!initialized) {
+        const int len = 2;
+        char val[len] = {0};
+        tuning_enabled = mkldnn_getenv(val, "MKLDNN_TUNE", len) == 1
+            && atoi(val) == 1;
+        if (mkldnn_getenv(db_path, "MKLDNN_TUNE_DB", max_path_len) <= 0)
+            db_path[0] = '\0';
+        initialized = true;
+    }
+    return tuning_enabled;
+}
+
+int tuned_impl_idx(engine_t *engine, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, const primitive_desc_t *hint_fwd_pd) {
+    using namespace primitive_kind;
+    if (!mkldnn_tuning()) return -1;
+    if (!utils::one_of(op_desc->kind, convolution, deconvolution,
+                convolution_relu))
+        return -1;
+
+    auto impl_list = engine->get_implementation_list();
+    primitive_desc_t *cands[max_candidates];
+    int cand_idx[max_candidates];
+    int ncands = 0;
+    for (int i = 0; impl_list[i] != nullptr && ncands < max_candidates; ++i) {
+        primitive_desc_t *pd = nullptr;
+        if (impl_list[i](&pd, op_desc, attr, engine, hint_fwd_pd)
+                != status::success)
+            continue;
+        cands[ncands] = pd;
+        cand_idx[ncands] = i;
+        ++ncands;
+    }
+
+    int best_idx = -1;
+    if (ncands > 1) {
+        std::lock_guard<std::recursive_mutex> guard(db_mutex);
+        if (!db_loaded) load_db();
+
+        const std::string key = make_key(op_desc, attr,
+                (const primitive_desc_t **)cands, ncands);
+        auto entry = db.find(key);
+        if (entry != db.end()) {
+            for (int c = 0; c < ncands && best_idx == -1; ++c)
+                if (entry->second == cands[c]->name())
+                    best_idx = cand_idx[c];
+        }
+
+        if (best_idx == -1) {
+            /* reference implementations are there for correctness only */
+            int best = -1;
+            double best_ms = -1;
+            for (int c = 0; c < ncands; ++c) {
+                if (strncmp(cands[c]->name(), "ref:", 4) == 0) continue;
+                const double ms = time_impl(cands[c]);
+                if (mkldnn_verbose()->level >= 2) {
+                    printf("mkldnn_verbose,tune,%s,%g\n", cands[c]->info(),
+                            ms);
+                    fflush(0);
+                }
+                if (ms >= 0 && (best_ms < 0 || ms < best_ms)) {
+                    best = c;
+                    best_ms = ms;
+                }
+            }
+            if (best != -1) {
+                best_idx = cand_idx[best];
+                store_db(key, cands[best]->name());
+            }
+        }
+    }
+
+    for (int c = 0; c < ncands; ++c)
+        delete cands[c];
+    return best_idx;
+}
+
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
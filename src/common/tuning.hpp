@@ -0,0 +1,44 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef TUNING_HPP
+#define TUNING_HPP
+
+#include "c_types_map.hpp"
+
+namespace mkldnn {
+namespace impl {
+
+/* Empirical choice of an implementation (MKLDNN_TUNE=1)
+ *
+ * By default the first implementation of the engine list whose init()
+ * succeeds is used. In tuning mode the viable implementations of a
+ * convolution (or deconvolution) are timed on scratch buffers when the
+ * primitive descriptor iterator is created, and the iterator starts with the
+ * fastest one. The results are kept for the process and, when
+ * MKLDNN_TUNE_DB is set to a file name, stored in that file so that later
+ * runs pick the implementation without timing anything. */
+bool mkldnn_tuning();
+
+/* Returns the index in the implementation list of the engine of the
+ * implementation to start with, or -1 to keep the static order */
+int tuned_impl_idx(engine_t *engine, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, const primitive_desc_t *hint_fwd_pd);
+
+}
+}
+
+#endif
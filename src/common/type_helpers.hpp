@@ -184,6 +184,8 @@ inline memory_format_t format_normalize(const memory_format_t fmt) {
             gOIdhw16o16i,
             gOidhw16o,
             gOdhwi16o,
+            Goidhw8g,
+            Goidhw16g,
             ntc,
             tnc,
             ldsnc,
@@ -208,8 +208,12 @@ template <typename pd_t> static void init_info_lrn(pd_t *s, char *buffer) {
     snprintf(aux_str, MKLDNN_VERBOSE_AUX_LEN,
             "alg:%s", mkldnn_alg_kind2str(s->desc()->alg_kind));
 
-    snprintf(prb_str, MKLDNN_VERBOSE_PRB_LEN,
-            "mb%dic%dih%diw%d", s->MB(), s->C(), s->H(), s->W());
+    if (s->is_3d())
+        snprintf(prb_str, MKLDNN_VERBOSE_PRB_LEN, "mb%dic%did%dih%diw%d",
+                s->MB(), s->C(), s->D(), s->H(), s->W());
+    else
+        snprintf(prb_str, MKLDNN_VERBOSE_PRB_LEN,
+                "mb%dic%dih%diw%d", s->MB(), s->C(), s->H(), s->W());
 
     verbose_templ(buffer, s->kind(), s->name(), s->desc()->prop_kind, dat_str,
             aux_str, prb_str);
@@ -15,12 +15,17 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <string.h>
 
 #include "cpu_engine.hpp"
 #include "cpu_memory.hpp"
+#include "mkldnn_thread.hpp"
 #include "type_helpers.hpp"
 #include "verbose.hpp"
 
+#include "cpu/gemm/gemm.hpp"
+#include "cpu/jit_generator.hpp"
+
 #include "cpu_concat.hpp"
 #include "cpu_sum.hpp"
 
@@ -28,6 +33,7 @@
 
 #include "cpu/jit_avx512_core_x8s8s32x_1x1_convolution.hpp"
 #include "cpu/jit_avx512_common_1x1_convolution.hpp"
+#include "cpu/jit_avx512_common_1x1_dw_convolution.hpp"
 #include "cpu/jit_avx512_core_fp32_wino_conv_4x3.hpp"
 #include "cpu/jit_avx512_common_convolution_winograd.hpp"
 #include "cpu/jit_avx512_core_x8s8s32x_convolution.hpp"
@@ -37,6 +43,8 @@
 #include "cpu/jit_avx2_convolution.hpp"
 #include "cpu/jit_sse42_convolution.hpp"
 #include "cpu/gemm_convolution.hpp"
+#include "cpu/gemm_wino_convolution.hpp"
+#include "cpu/fft_convolution.hpp"
 #include "cpu/gemm_u8s8s32x_convolution.hpp"
 #include "cpu/ref_convolution.hpp"
 #include "cpu/ref_deconvolution.hpp"
@@ -51,6 +59,7 @@
 #include "cpu/nhwc_pooling.hpp"
 #include "cpu/jit_avx512_common_lrn.hpp"
 #include "cpu/jit_uni_lrn.hpp"
+#include "cpu/simple_lrn.hpp"
 #include "cpu/ref_lrn.hpp"
 #include "cpu/jit_uni_batch_normalization.hpp"
 #include "cpu/ref_batch_normalization.hpp"
@@ -101,6 +110,7 @@ static const pd_create_f cpu_impl_list[] = {
     INSTANCE(jit_avx512_common_dw_convolution_fwd_t),
     INSTANCE(jit_avx512_common_dw_convolution_bwd_data_t),
     INSTANCE(jit_avx512_common_dw_convolution_bwd_weights_t),
+    INSTANCE(jit_avx512_common_1x1_dw_convolution_fwd_t),
     INSTANCE(jit_avx512_common_1x1_convolution_fwd_f32_t),
     INSTANCE(jit_avx512_common_1x1_convolution_bwd_data_f32_t),
     INSTANCE(jit_avx512_common_1x1_convolution_bwd_weights_t),
@@ -113,6 +123,12 @@ static const pd_create_f cpu_impl_list[] = {
     INSTANCE(jit_avx512_common_convolution_winograd_fwd_t),
     INSTANCE(jit_avx512_common_convolution_winograd_bwd_data_t),
     INSTANCE(jit_avx512_common_convolution_winograd_bwd_weights_t),
+    INSTANCE(gemm_wino_convolution_fwd_t),
+    INSTANCE(gemm_wino_convolution_bwd_data_t),
+    INSTANCE(gemm_wino_convolution_bwd_weights_t),
+    INSTANCE(fft_convolution_fwd_t),
+    INSTANCE(fft_convolution_bwd_data_t),
+    INSTANCE(fft_convolution_bwd_weights_t),
     INSTANCE(jit_avx512_common_convolution_fwd_t<f32>),
     INSTANCE(jit_avx512_common_convolution_bwd_data_t<f32>),
     INSTANCE(jit_avx512_common_convolution_bwd_weights_t<f32>),
@@ -232,6 +248,8 @@ static const pd_create_f cpu_impl_list[] = {
     INSTANCE(jit_uni_lrn_fwd_t<avx2>),
     INSTANCE(jit_uni_lrn_bwd_t<avx2>),
     INSTANCE(jit_uni_lrn_fwd_t<sse42>),
+    INSTANCE(simple_lrn_fwd_t<f32>),
+    INSTANCE(simple_lrn_bwd_t<f32>),
     INSTANCE(ref_lrn_fwd_t<f32>),
     INSTANCE(ref_lrn_bwd_t<f32>),
     /* batch normalization */
@@ -268,6 +286,8 @@ static const pd_create_f cpu_impl_list[] = {
     /* conv_eltwise */
     INSTANCE(jit_avx512_common_dw_convolution_relu_t),
     INSTANCE(jit_avx512_common_convolution_winograd_relu_t),
+    INSTANCE(gemm_wino_convolution_relu_t),
+    INSTANCE(fft_convolution_relu_t),
     INSTANCE(jit_avx512_common_1x1_convolution_relu_f32_t),
     INSTANCE(jit_avx512_common_convolution_relu_t<f32>),
     INSTANCE(jit_avx2_dw_convolution_relu_t),
@@ -319,6 +339,100 @@ const pd_create_f* cpu_engine_t::get_implementation_list() const {
     return cpu_impl_list;
 }
 
+namespace {
+/* Attainable rates of the machine with all the threads, measured once per
+ * process: the flop rate of an sgemm with cache friendly blocks and the
+ * memory bandwidth (read plus write) of a copy twice the size of the last
+ * level cache */
+struct machine_rates_t {
+    double flops, bytes;
+
+    machine_rates_t(): flops(0), bytes(0) {
+        const int max_nthr = mkldnn_get_max_threads();
+
+        const int m = 256, k = 256, n = 512 * max_nthr;
+        float *a = (float *)malloc(sizeof(float) * m * k, 64);
+        float *b = (float *)malloc(sizeof(float) * k * n, 64);
+        float *c = (float *)malloc(sizeof(float) * m * n, 64);
+        if (utils::everyone_is(true, a != nullptr, b != nullptr,
+                    c != nullptr)) {
+            utils::array_set(a, 1.f, m * k);
+            utils::array_set(b, 1.f, (size_t)k * n);
+            const float one = 1.f, zero = 0.f;
+            double best = 0;
+            for (int r = 0; r < 4; ++r) {
+                double ms = get_msec();
+                extended_sgemm("N", "N", &m, &n, &k, &one, a, &m, b, &k,
+                        &zero, c, &m);
+                ms = get_msec() - ms;
+                if (r > 0 && (best == 0 || ms < best)) best = ms;
+            }
+            flops = 2e3 * m * n * k / nstl::max(best, 1e-3);
+        }
+        free(a); free(b); free(c);
+
+        size_t llc = get_cache_size(3, false);
+        if (llc == 0) llc = get_cache_size(2, false);
+        const size_t size = nstl::min(nstl::max(2 * (size_t)llc,
+                    (size_t)32 << 20), (size_t)256 << 20);
+        char *src = (char *)malloc(size, 64);
+        char *dst = (char *)malloc(size, 64);
+        if (src != nullptr && dst != nullptr) {
+            /* the pages go to the threads that copy them */
+            auto copy = [&](const int ithr, const int nthr) {
+                size_t start{0}, end{0};
+                balance211(size / 64, nthr, ithr, start, end);
+                memcpy(dst + 64 * start, src + 64 * start, 64 * (end - start));
+            };
+            parallel(max_nthr, [&](const int ithr, const int nthr) {
+                size_t start{0}, end{0};
+                balance211(size / 64, nthr, ithr, start, end);
+                memset(src + 64 * start, 0, 64 * (end - start));
+                memset(dst + 64 * start, 0, 64 * (end - start));
+            });
+            double best = 0;
+            for (int r = 0; r < 3; ++r) {
+                double ms = get_msec();
+                parallel(max_nthr, copy);
+                ms = get_msec() - ms;
+                if (best == 0 || ms < best) best = ms;
+            }
+            bytes = 2e3 * size / nstl::max(best, 1e-3);
+        }
+        free(src); free(dst);
+    }
+};
+
+const machine_rates_t &machine_rates() {
+    static const machine_rates_t rates;
+    return rates;
+}
+}
+
+double cpu_engine_t::flops_rate() const { return machine_rates().flops; }
+double cpu_engine_t::bytes_rate() const { return machine_rates().bytes; }
+
+double cpu_engine_t::efficiency(const char *impl_name) const {
+    /* Relative to the sgemm rate. The jit kernels are scaled by the vector
+     * width of the isa they were generated for; gemm based implementations
+     * use the best sgemm of the machine. Winograd implementations do about
+     * half the multiplications of the direct method. */
+    if (!strncmp(impl_name, "ref:", 4)) return 1e-3;
+    double e = 1.;
+    if (!strncmp(impl_name, "gemm", 4)) {
+        e = 0.8;
+    } else {
+        const int machine_w = mayiuse(avx512_common) ? 16 : mayiuse(avx) ? 8
+            : 4;
+        const int impl_w = strstr(impl_name, "avx512") ? 16
+            : strstr(impl_name, "avx") ? 8
+            : strstr(impl_name, "sse") ? 4 : machine_w;
+        e = (double)nstl::min(impl_w, machine_w) / machine_w;
+    }
+    if (strstr(impl_name, "wino") != nullptr) e *= 2;
+    return e;
+}
+
 cpu_engine_factory_t engine_factory;
 
 status_t cpu_engine_t::submit(primitive_t *p, event_t *e,
@@ -23,6 +23,7 @@
 
 #include "c_types_map.hpp"
 #include "../common/engine.hpp"
+#include "../common/numa.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -50,6 +51,10 @@ public:
     virtual const sum_primitive_desc_create_f*
         get_sum_implementation_list() const;
     virtual const primitive_desc_create_f* get_implementation_list() const;
+
+    virtual double flops_rate() const;
+    virtual double bytes_rate() const;
+    virtual double efficiency(const char *impl_name) const;
 };
 
 class cpu_engine_factory_t: public engine_factory_t {
@@ -58,6 +63,7 @@ public:
     virtual engine_kind_t kind() const { return engine_kind::cpu; }
     virtual status_t engine_create(engine_t **engine, size_t index) const {
         assert(index == 0);
+        numa_bind_threads();
         *engine = new cpu_engine_t();
         return status::success;
     };
@@ -343,6 +343,8 @@ status_t cpu_memory_t::typed_zero_pad() {
     MAYBE_WEIGHTS(gOdhwi8o);
     MAYBE_WEIGHTS(Goihw8g);
     MAYBE_WEIGHTS(Goihw16g);
+    MAYBE_WEIGHTS(Goidhw8g);
+    MAYBE_WEIGHTS(Goidhw16g);
 #   undef MAYBE_WEIGHTS
 
     // the last line of defence
@@ -0,0 +1,784 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <math.h>
+
+#include "mkldnn_types.h"
+
+#include "c_types_map.hpp"
+#include "fft_convolution.hpp"
+#include "gemm/gemm.hpp"
+#include "mkldnn_thread.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace mkldnn::impl::status;
+using namespace mkldnn::impl::memory_format;
+using namespace mkldnn::impl::utils;
+
+namespace {
+
+const int simd_w = 8;
+
+int next_pow2(int v) {
+    int p = 1;
+    while (p < v) p <<= 1;
+    return p;
+}
+
+/* In-place radix-2 transform of n complex points of simd_w lanes each;
+ * point i lives at re[i * stride], im[i * stride]. The inverse transform is
+ * not scaled. */
+void cfft(const fft_plan_1d_t &p, float *re, float *im, size_t stride,
+        bool inverse) {
+    const int n = p.n;
+    for (int i = 0; i < n; ++i) {
+        const int j = p.bitrev[i];
+        if (i >= j) continue;
+        float *ar = re + i * stride, *ai = im + i * stride;
+        float *br = re + j * stride, *bi = im + j * stride;
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; ++v) {
+            const float tr = ar[v], ti = ai[v];
+            ar[v] = br[v]; ai[v] = bi[v];
+            br[v] = tr; bi[v] = ti;
+        }
+    }
+
+    for (int len = 2; len <= n; len <<= 1) {
+        const int half = len / 2, step = n / len;
+        for (int i = 0; i < n; i += len)
+        for (int j = 0; j < half; ++j) {
+            const float wr = p.wr[j * step];
+            const float wi = inverse ? -p.wi[j * step] : p.wi[j * step];
+            float *ar = re + (i + j) * stride, *ai = im + (i + j) * stride;
+            float *br = ar + half * stride, *bi = ai + half * stride;
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) {
+                const float tr = br[v] * wr - bi[v] * wi;
+                const float ti = br[v] * wi + bi[v] * wr;
+                br[v] = ar[v] - tr; bi[v] = ai[v] - ti;
+                ar[v] += tr; ai[v] += ti;
+            }
+        }
+    }
+}
+
+/* Real-to-complex 2D transform of x[th][tw][simd_w] into
+ * Fr, Fi[th][tw / 2 + 1][simd_w]. Only the first nrows rows of x may be
+ * non-zero. Each real row is transformed as a complex one of tw / 2 points
+ * z[n] = x[2n] + i x[2n + 1] and then split into the spectra of its even
+ * and odd samples. z is a scratch of 2 * tw / 2 * simd_w floats. */
+void rfft2d(const fft_plan_t &p, const float *x, int nrows, float *Fr,
+        float *Fi, float *z) {
+    const int th = p.col.n, N = p.row.n, tw = 2 * N;
+    const size_t ld = (size_t)(N + 1) * simd_w;
+    float *zr = z, *zi = z + N * simd_w;
+
+    for (int r = 0; r < th; ++r) {
+        float *yr = Fr + r * ld, *yi = Fi + r * ld;
+        if (r >= nrows) {
+            array_set(yr, 0.f, ld);
+            array_set(yi, 0.f, ld);
+            continue;
+        }
+        const float *xr = x + (size_t)r * tw * simd_w;
+        for (int n = 0; n < N; ++n) {
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) {
+                zr[n * simd_w + v] = xr[2 * n * simd_w + v];
+                zi[n * simd_w + v] = xr[(2 * n + 1) * simd_w + v];
+            }
+        }
+        cfft(p.row, zr, zi, simd_w, false);
+
+        for (int k = 0; k <= N; ++k) {
+            const int k0 = k % N, k1 = (N - k) % N;
+            const float wr = p.rr[k], wi = p.ri[k];
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) {
+                const float ar = zr[k0 * simd_w + v], ai = zi[k0 * simd_w + v];
+                const float br = zr[k1 * simd_w + v];
+                const float bi = -zi[k1 * simd_w + v];
+                const float er = .5f * (ar + br), ei = .5f * (ai + bi);
+                const float or_ = .5f * (ai - bi), oi = -.5f * (ar - br);
+                yr[k * simd_w + v] = er + wr * or_ - wi * oi;
+                yi[k * simd_w + v] = ei + wr * oi + wi * or_;
+            }
+        }
+    }
+
+    if (th > 1)
+        for (int k = 0; k <= N; ++k)
+            cfft(p.col, Fr + k * simd_w, Fi + k * simd_w, ld, false);
+}
+
+/* Inverse of rfft2d up to the th * tw / 2 scale: Fr, Fi are overwritten,
+ * the first nrows rows of the real result are written to x */
+void irfft2d(const fft_plan_t &p, float *Fr, float *Fi, int nrows, float *x,
+        float *z) {
+    const int th = p.col.n, N = p.row.n, tw = 2 * N;
+    const size_t ld = (size_t)(N + 1) * simd_w;
+    float *zr = z, *zi = z + N * simd_w;
+
+    if (th > 1)
+        for (int k = 0; k <= N; ++k)
+            cfft(p.col, Fr + k * simd_w, Fi + k * simd_w, ld, true);
+
+    for (int r = 0; r < nrows; ++r) {
+        const float *yr = Fr + r * ld, *yi = Fi + r * ld;
+        for (int k = 0; k < N; ++k) {
+            const float wr = p.rr[k], wi = p.ri[k];
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) {
+                const float ar = yr[k * simd_w + v], ai = yi[k * simd_w + v];
+                const float br = yr[(N - k) * simd_w + v];
+                const float bi = -yi[(N - k) * simd_w + v];
+                const float er = ar + br, ei = ai + bi;
+                const float dr = ar - br, di = ai - bi;
+                const float or_ = dr * wr + di * wi, oi = di * wr - dr * wi;
+                zr[k * simd_w + v] = .5f * (er - oi);
+                zi[k * simd_w + v] = .5f * (ei + or_);
+            }
+        }
+        cfft(p.row, zr, zi, simd_w, true);
+
+        float *xr = x + (size_t)r * tw * simd_w;
+        for (int n = 0; n < N; ++n) {
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) {
+                xr[2 * n * simd_w + v] = zr[n * simd_w + v];
+                xr[(2 * n + 1) * simd_w + v] = zi[n * simd_w + v];
+            }
+        }
+    }
+}
+
+inline void tile_coords(const fft_conv_conf_t &jcp, int tile, int &n,
+        int &y0, int &x0) {
+    const int tw = tile % jcp.tiles_w;
+    const int th = (tile / jcp.tiles_w) % jcp.tiles_h;
+    n = tile / (jcp.tiles_w * jcp.tiles_h);
+    y0 = th * jcp.bh;
+    x0 = tw * jcp.bw;
+}
+
+size_t tile_scratch_size(const fft_conv_conf_t &jcp) {
+    /* real tile, its spectrum and the row scratch */
+    return (size_t)simd_w * (jcp.th * jcp.tw + 2 * jcp.nbins + jcp.tw);
+}
+
+/* Spectrum of the input window of a tile for channels c0 .. c0 + simd_w of
+ * group g, scattered to X[f][t][re, im][ic_padded] */
+void src_transform_tile(const fft_conv_conf_t &jcp, const fft_plan_t &p,
+        const float *src, int g, int tile, int c0, float *X, int t,
+        float *scratch) {
+    float *x = scratch, *Fr = x + jcp.th * jcp.tw * simd_w;
+    float *Fi = Fr + jcp.nbins * simd_w, *z = Fi + jcp.nbins * simd_w;
+    int n, y0, x0;
+    tile_coords(jcp, tile, n, y0, x0);
+
+    const int hs = y0 - jcp.t_pad, ws = x0 - jcp.l_pad;
+    const int i_s = nstl::max(0, -hs), i_e = nstl::min(jcp.th, jcp.ih - hs);
+    const int j_s = nstl::max(0, -ws), j_e = nstl::min(jcp.tw, jcp.iw - ws);
+    const int nrows = nstl::max(0, i_e);
+
+    array_set(x, 0.f, (size_t)nrows * jcp.tw * simd_w);
+    for (int v = 0; v < simd_w; ++v) {
+        const int c = c0 + v;
+        if (c >= jcp.ic) break;
+        const float *s = src + ((size_t)n * jcp.ngroups * jcp.ic
+                + g * jcp.ic + c) * jcp.ih * jcp.iw;
+        for (int i = i_s; i < i_e; ++i)
+        for (int j = j_s; j < j_e; ++j)
+            x[(i * jcp.tw + j) * simd_w + v] = s[(hs + i) * jcp.iw + ws + j];
+    }
+
+    rfft2d(p, x, nrows, Fr, Fi, z);
+
+    const int ic2 = 2 * jcp.ic_padded;
+    for (int f = 0; f < jcp.nbins; ++f) {
+        float *xf = &X[(size_t)f * jcp.x_ld + t * ic2 + c0];
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; ++v) {
+            xf[v] = Fr[f * simd_w + v];
+            xf[jcp.ic_padded + v] = Fi[f * simd_w + v];
+        }
+    }
+}
+
+/* Output pixels of a tile for channels o0 .. o0 + simd_w of group g from
+ * Y[f][t][re, im][re, im][oc_padded], with bias, sum and relu applied */
+void dst_transform_tile(const fft_conv_conf_t &jcp, const fft_plan_t &p,
+        const float *Y, int t, int g, int tile, int o0, const float *bias,
+        float *dst, float *scratch) {
+    float *y = scratch, *Fr = y + jcp.th * jcp.tw * simd_w;
+    float *Fi = Fr + jcp.nbins * simd_w, *z = Fi + jcp.nbins * simd_w;
+    int n, y0, x0;
+    tile_coords(jcp, tile, n, y0, x0);
+
+    /* the product of the [re | im] weights with re x and im x of the
+     * tile: re y = re w re x - im w im x, im y = im w re x + re w im x */
+    const int ocp = jcp.oc_padded, oc2 = 2 * ocp;
+    for (int f = 0; f < jcp.nbins; ++f) {
+        const float *yr = &Y[(size_t)f * jcp.y_ld + t * 2 * oc2 + o0];
+        const float *yi = yr + oc2;
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; ++v) {
+            Fr[f * simd_w + v] = yr[v] - yi[ocp + v];
+            Fi[f * simd_w + v] = yr[ocp + v] + yi[v];
+        }
+    }
+
+    const int i_e = nstl::min(jcp.bh, jcp.oh - y0);
+    const int j_e = nstl::min(jcp.bw, jcp.ow - x0);
+    irfft2d(p, Fr, Fi, i_e, y, z);
+
+    const float nslope = jcp.relu_negative_slope;
+    for (int v = 0; v < simd_w; ++v) {
+        const int o = o0 + v;
+        if (o >= jcp.oc) break;
+        const float b = bias ? bias[g * jcp.oc + o] : 0.f;
+        float *d = dst + ((size_t)n * jcp.ngroups * jcp.oc + g * jcp.oc + o)
+            * jcp.oh * jcp.ow;
+        for (int i = 0; i < i_e; ++i)
+        for (int j = 0; j < j_e; ++j) {
+            float &dd = d[(y0 + i) * jcp.ow + x0 + j];
+            float r = y[(i * jcp.tw + j) * simd_w + v] + b;
+            if (jcp.with_sum) r += dd;
+            if (jcp.with_relu && r < 0.f) r *= nslope;
+            dd = r;
+        }
+    }
+}
+
+/* W[g][f] = conj(FFT(w)) / (th * tw / 2) as the real 2 oc x ic matrix
+ * [re; im] stored column major with ld = 2 * oc_padded. Keeping the real
+ * and imaginary parts of the input apart in the product instead of the
+ * 2 oc x 2 ic real form of the complex matrix halves the memory traffic on
+ * the transformed weights. For backward by data ic and oc are the output
+ * and input channels and the kernel is rotated by 180 degrees. */
+void transform_weights(const fft_conv_conf_t &jcp, const fft_plan_t &p,
+        const float *wei, float *W, bool bwd_data, float *ws,
+        size_t ws_per_thread) {
+    const int icp = jcp.ic_padded, ocp = jcp.oc_padded;
+    const int KH = jcp.kh, KW = jcp.kw, KHW = KH * KW;
+    const float scale = 2.f / (jcp.th * jcp.tw);
+    const size_t w_size = jcp.w_ld;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        float *k = ws + ithr * ws_per_thread;
+        float *Fr = k + jcp.th * jcp.tw * simd_w;
+        float *Fi = Fr + jcp.nbins * simd_w, *z = Fi + jcp.nbins * simd_w;
+
+        const int nb_oc = ocp / simd_w;
+        const size_t work_amount = (size_t)jcp.ngroups * icp * nb_oc;
+        size_t start{0}, end{0};
+        balance211(work_amount, nthr, ithr, start, end);
+
+        int g{0}, c{0}, ob{0};
+        nd_iterator_init(start, g, jcp.ngroups, c, icp, ob, nb_oc);
+        for (size_t iwork = start; iwork < end; ++iwork) {
+            array_set(k, 0.f, (size_t)KH * jcp.tw * simd_w);
+            if (c < jcp.ic) {
+                for (int v = 0; v < simd_w; ++v) {
+                    const int o = ob * simd_w + v;
+                    if (o >= jcp.oc) break;
+                    for (int i = 0; i < KH; ++i)
+                    for (int j = 0; j < KW; ++j) {
+                        const size_t idx = bwd_data
+                            ? ((size_t)(g * jcp.ic + c) * jcp.oc + o) * KHW
+                                + (KH - 1 - i) * KW + KW - 1 - j
+                            : ((size_t)(g * jcp.oc + o) * jcp.ic + c) * KHW
+                                + i * KW + j;
+                        k[(i * jcp.tw + j) * simd_w + v] = wei[idx];
+                    }
+                }
+            }
+            rfft2d(p, k, KH, Fr, Fi, z);
+
+            float *Wg = W + (size_t)g * jcp.nbins * w_size;
+            for (int f = 0; f < jcp.nbins; ++f) {
+                float *wf = Wg + f * w_size + (size_t)c * 2 * ocp
+                    + ob * simd_w;
+                PRAGMA_OMP_SIMD()
+                for (int v = 0; v < simd_w; ++v) {
+                    wf[v] = scale * Fr[f * simd_w + v];
+                    wf[ocp + v] = -scale * Fi[f * simd_w + v];
+                }
+            }
+            nd_iterator_step(g, jcp.ngroups, c, icp, ob, nb_oc);
+        }
+    });
+}
+
+/* The data pass of forward and backward by data: each thread takes whole
+ * blocks of tiles of a group and runs FFT -> nbins sgemm -> inverse FFT on
+ * them with X and Y kept in its own workspace */
+void data_pass(const fft_conv_conf_t &jcp, const fft_plan_t &p,
+        const float *src, const float *W, const float *bias, float *dst,
+        float *ws, size_t ws_per_thread) {
+    const int icp = jcp.ic_padded, ocp = jcp.oc_padded, oc2 = 2 * ocp;
+    const size_t w_size = jcp.w_ld;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        int start{0}, end{0};
+        balance211(jcp.ngroups * jcp.nb_tile_blocks, nthr, ithr, start, end);
+
+        float *X = ws + ithr * ws_per_thread;
+        float *Y = X + (size_t)jcp.nbins * jcp.x_ld;
+        float *scratch = Y + (size_t)jcp.nbins * jcp.y_ld;
+
+        for (int iwork = start; iwork < end; ++iwork) {
+            const int g = iwork / jcp.nb_tile_blocks;
+            const int tblk = iwork % jcp.nb_tile_blocks;
+            const int tile_start = tblk * jcp.tile_block;
+            const int nt = nstl::min(jcp.ntiles - tile_start,
+                    jcp.tile_block);
+
+            for (int t = 0; t < nt; ++t)
+            for (int c0 = 0; c0 < icp; c0 += simd_w)
+                src_transform_tile(jcp, p, src, g, tile_start + t, c0, X, t,
+                        scratch);
+
+            const float one = 1.f, zero = 0.f;
+            const int nt2 = 2 * nt;
+            const float *Wg = W + (size_t)g * jcp.nbins * w_size;
+            for (int f = 0; f < jcp.nbins; ++f)
+                extended_sgemm("N", "N", &oc2, &nt2, &icp, &one,
+                        Wg + f * w_size, &oc2,
+                        X + (size_t)f * jcp.x_ld, &icp,
+                        &zero, Y + (size_t)f * jcp.y_ld, &oc2);
+
+            for (int t = 0; t < nt; ++t)
+            for (int o0 = 0; o0 < ocp; o0 += simd_w)
+                dst_transform_tile(jcp, p, Y, t, g, tile_start + t, o0, bias,
+                        dst, scratch);
+        }
+    });
+}
+
+size_t data_pass_ws_per_thread(const fft_conv_conf_t &jcp) {
+    return (size_t)jcp.nbins * (jcp.x_ld + jcp.y_ld) + tile_scratch_size(jcp);
+}
+
+}
+
+namespace fft_convolution_utils {
+
+status_t init_conf(fft_conv_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &dst_d,
+        const primitive_attr_t &attr, bool with_relu,
+        float relu_negative_slope) {
+    const bool bwd_data = cd.prop_kind == prop_kind::backward_data;
+    const bool bwd_weights = cd.prop_kind == prop_kind::backward_weights;
+    const memory_desc_wrapper wei_d(
+            bwd_weights ? &cd.diff_weights_desc : &cd.weights_desc);
+
+    const int ndims = src_d.ndims();
+    const bool is_1d = ndims == 3;
+    const bool with_groups = wei_d.ndims() == ndims + 1;
+
+    jcp.ndims = ndims;
+    jcp.ngroups = with_groups ? wei_d.dims()[0] : 1;
+    jcp.kh = is_1d ? 1 : wei_d.dims()[with_groups + 2];
+    jcp.kw = wei_d.dims()[with_groups + ndims - 1];
+
+    const int stride_h = is_1d ? 1 : cd.strides[0];
+    const int stride_w = cd.strides[ndims - 3];
+    const int dilate_h = is_1d ? 0 : cd.dilates[0];
+    const int dilate_w = cd.dilates[ndims - 3];
+    const int pad_t = is_1d ? 0 : cd.padding[0][0];
+    const int pad_l = cd.padding[0][ndims - 3];
+
+    bool ok = true
+        && stride_h == 1 && stride_w == 1
+        && dilate_h == 0 && dilate_w == 0
+        && jcp.kh * jcp.kw > 1;
+    if (!ok) return unimplemented;
+
+    /* the data pass reads diff_dst and writes diff_src when going backward
+     * by data */
+    const memory_desc_wrapper &in_d = bwd_data ? dst_d : src_d;
+    const memory_desc_wrapper &out_d = bwd_data ? src_d : dst_d;
+
+    jcp.mb = src_d.dims()[0];
+    jcp.ic = in_d.dims()[1] / jcp.ngroups;
+    jcp.oc = out_d.dims()[1] / jcp.ngroups;
+    jcp.ic_padded = rnd_up(jcp.ic, simd_w);
+    jcp.oc_padded = rnd_up(jcp.oc, simd_w);
+    jcp.ih = is_1d ? 1 : in_d.dims()[2];
+    jcp.iw = in_d.dims()[ndims - 1];
+    jcp.oh = is_1d ? 1 : out_d.dims()[2];
+    jcp.ow = out_d.dims()[ndims - 1];
+    jcp.t_pad = bwd_data ? jcp.kh - 1 - pad_t : pad_t;
+    jcp.l_pad = bwd_data ? jcp.kw - 1 - pad_l : pad_l;
+
+    /* windows of about twice the kernel size; 1D windows are cheap in the
+     * number of bins, so they are made longer to waste less on the overlap
+     * of the tiles */
+    const int max_n = fft_plan_1d_t::max_n;
+    jcp.th = jcp.kh == 1 ? 1 : nstl::min(next_pow2(2 * jcp.kh - 1),
+            next_pow2(jcp.oh + jcp.kh - 1));
+    jcp.tw = nstl::min(next_pow2((jcp.kh == 1 ? 4 : 2) * jcp.kw - 1),
+            next_pow2(jcp.ow + jcp.kw - 1));
+    jcp.tw = nstl::max(4, jcp.tw);
+    if (jcp.th > max_n || jcp.tw > 2 * max_n) return unimplemented;
+
+    jcp.bh = jcp.th - jcp.kh + 1;
+    jcp.bw = jcp.tw - jcp.kw + 1;
+    jcp.nbins = jcp.th * (jcp.tw / 2 + 1);
+
+    /* leave small kernels to direct methods */
+    if (speedup(jcp) <= 1.f) return unimplemented;
+
+    jcp.tiles_h = div_up(jcp.oh, jcp.bh);
+    jcp.tiles_w = div_up(jcp.ow, jcp.bw);
+    jcp.ntiles = jcp.mb * jcp.tiles_h * jcp.tiles_w;
+
+    const int nthr = mkldnn_get_max_threads();
+    if (bwd_weights) {
+        /* blocks of tiles are processed one at a time by all the threads */
+        jcp.tile_block = nstl::min(jcp.ntiles, nstl::max(32, 4 * nthr));
+    } else {
+        /* the spectra of a tile are much larger than L2 anyway; the block
+         * size trades the reuse of the transformed weights of a bin against
+         * the balance between the threads */
+        const int nwork = div_up(jcp.ntiles * jcp.ngroups, nthr);
+        const int tb = nstl::max(1, nstl::min(64, nwork));
+        /* even out the blocks of a group */
+        jcp.tile_block = div_up(jcp.ntiles, div_up(jcp.ntiles, tb));
+    }
+    jcp.nb_tile_blocks = div_up(jcp.ntiles, jcp.tile_block);
+
+    /* the bins of a tile are written at a power of 2 distance from each
+     * other more often than not; an extra cache line per bin keeps them off
+     * the same cache sets */
+    const int line = 64 / sizeof(float);
+    jcp.x_ld = jcp.tile_block * 2 * jcp.ic_padded + line;
+    jcp.y_ld = jcp.tile_block * 4 * jcp.oc_padded + line;
+    jcp.w_ld = 2 * jcp.ic_padded * jcp.oc_padded + line;
+
+    const auto &p = attr.post_ops_;
+    jcp.with_bias = !bwd_data && !memory_desc_wrapper(bwd_weights
+            ? cd.diff_bias_desc : cd.bias_desc).is_zero();
+    jcp.with_sum = p.find(primitive_kind::sum) != -1;
+    jcp.with_relu = with_relu;
+    jcp.relu_negative_slope = relu_negative_slope;
+    const int relu_idx = p.find(primitive_kind::eltwise);
+    if (relu_idx != -1) {
+        jcp.with_relu = true;
+        jcp.relu_negative_slope = p.entry_[relu_idx].eltwise.alpha;
+    }
+
+    return success;
+}
+
+float speedup(const fft_conv_conf_t &jcp) {
+    /* a bin costs a 2ic x 2oc real product, i.e. 8 flops per ic * oc, and
+     * the transforms are not free */
+    const int ovh = nstl::min(jcp.bh, jcp.oh), ovw = nstl::min(jcp.bw, jcp.ow);
+    const float fft_cost = 1.25f * 8.f * jcp.nbins / (ovh * ovw);
+    const float direct_cost = 2.f * jcp.kh * jcp.kw;
+    return direct_cost / fft_cost;
+}
+
+size_t scratchpad_size(const fft_conv_conf_t &jcp, bool bwd_weights) {
+    const size_t nthr = mkldnn_get_max_threads();
+    const size_t ws = bwd_weights
+        ? data_pass_ws_per_thread(jcp) + tile_scratch_size(jcp) * nthr
+        : data_pass_ws_per_thread(jcp) * nthr;
+    const size_t wei = (size_t)(bwd_weights ? 1 : jcp.ngroups) * jcp.nbins
+        * jcp.w_ld;
+    return sizeof(float) * (ws + wei);
+}
+
+void init_plan(const fft_conv_conf_t &jcp, fft_plan_t &plan) {
+    const double pi = 3.14159265358979323846;
+
+    auto init_1d = [&](fft_plan_1d_t &p, int n) {
+        p.n = n;
+        int log2n = 0;
+        while ((1 << log2n) < n) ++log2n;
+        for (int i = 0; i < n; ++i) {
+            int r = 0;
+            for (int b = 0; b < log2n; ++b)
+                if (i & (1 << b)) r |= 1 << (log2n - 1 - b);
+            p.bitrev[i] = r;
+        }
+        for (int k = 0; k < n / 2; ++k) {
+            p.wr[k] = (float)cos(2 * pi * k / n);
+            p.wi[k] = (float)-sin(2 * pi * k / n);
+        }
+    };
+
+    init_1d(plan.col, jcp.th);
+    init_1d(plan.row, jcp.tw / 2);
+    for (int k = 0; k <= jcp.tw / 2; ++k) {
+        plan.rr[k] = (float)cos(2 * pi * k / jcp.tw);
+        plan.ri[k] = (float)-sin(2 * pi * k / jcp.tw);
+    }
+}
+
+}
+
+template <bool with_relu>
+_fft_convolution_fwd_t<with_relu>::_fft_convolution_fwd_t(
+        const pd_t *pd, const input_vector &inputs,
+        const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd) {
+    const auto &jcp = conf_.jcp_;
+
+    fft_convolution_utils::init_plan(jcp, plan_);
+    fft_wei_ = (data_t *)malloc(sizeof(data_t) * jcp.ngroups * jcp.nbins
+            * jcp.w_ld, 64);
+    ws_per_thread_ = data_pass_ws_per_thread(jcp);
+    ws_ = (data_t *)malloc(sizeof(data_t) * ws_per_thread_
+            * mkldnn_get_max_threads(), 64);
+}
+
+template <bool with_relu>
+_fft_convolution_fwd_t<with_relu>::~_fft_convolution_fwd_t() {
+    free(fft_wei_);
+    free(ws_);
+}
+
+template <bool with_relu>
+void _fft_convolution_fwd_t<with_relu>::execute_forward() {
+    auto src = reinterpret_cast<const data_t *>(this->input_memory(0));
+    auto weights = reinterpret_cast<const data_t *>(this->input_memory(1));
+    auto bias = reinterpret_cast<const data_t *>(this->input_memory(2));
+    auto dst = reinterpret_cast<data_t *>(this->memory());
+
+    const auto &jcp = conf_.jcp_;
+
+    transform_weights(jcp, plan_, weights, fft_wei_, false, ws_,
+            ws_per_thread_);
+    data_pass(jcp, plan_, src, fft_wei_, jcp.with_bias ? bias : nullptr, dst,
+            ws_, ws_per_thread_);
+}
+
+template struct _fft_convolution_fwd_t<true>;
+template struct _fft_convolution_fwd_t<false>;
+
+fft_convolution_bwd_data_t::fft_convolution_bwd_data_t(
+        const pd_t *pd, const input_vector &inputs,
+        const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd) {
+    const auto &jcp = conf_.jcp_;
+
+    fft_convolution_utils::init_plan(jcp, plan_);
+    fft_wei_ = (data_t *)malloc(sizeof(data_t) * jcp.ngroups * jcp.nbins
+            * jcp.w_ld, 64);
+    ws_per_thread_ = data_pass_ws_per_thread(jcp);
+    ws_ = (data_t *)malloc(sizeof(data_t) * ws_per_thread_
+            * mkldnn_get_max_threads(), 64);
+}
+
+fft_convolution_bwd_data_t::~fft_convolution_bwd_data_t() {
+    free(fft_wei_);
+    free(ws_);
+}
+
+void fft_convolution_bwd_data_t::execute_backward_data() {
+    auto diff_dst = reinterpret_cast<const data_t *>(this->input_memory(0));
+    auto weights = reinterpret_cast<const data_t *>(this->input_memory(1));
+    auto diff_src = reinterpret_cast<data_t *>(this->memory());
+
+    const auto &jcp = conf_.jcp_;
+
+    transform_weights(jcp, plan_, weights, fft_wei_, true, ws_,
+            ws_per_thread_);
+    data_pass(jcp, plan_, diff_dst, fft_wei_, nullptr, diff_src, ws_,
+            ws_per_thread_);
+}
+
+fft_convolution_bwd_weights_t::fft_convolution_bwd_weights_t(
+        const pd_t *pd, const input_vector &inputs,
+        const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd) {
+    const auto &jcp = conf_.jcp_;
+
+    fft_convolution_utils::init_plan(jcp, plan_);
+    fft_diff_wei_ = (data_t *)malloc(sizeof(data_t) * jcp.nbins
+            * jcp.w_ld, 64);
+    ws_ = (data_t *)malloc(sizeof(data_t) * (data_pass_ws_per_thread(jcp)
+            + tile_scratch_size(jcp) * mkldnn_get_max_threads()), 64);
+}
+
+fft_convolution_bwd_weights_t::~fft_convolution_bwd_weights_t() {
+    free(fft_diff_wei_);
+    free(ws_);
+}
+
+void fft_convolution_bwd_weights_t::execute_backward_weights() {
+    auto src = reinterpret_cast<const data_t *>(this->input_memory(0));
+    auto diff_dst = reinterpret_cast<const data_t *>(this->input_memory(1));
+    auto diff_weights = reinterpret_cast<data_t *>(this->memory(0));
+    auto diff_bias = reinterpret_cast<data_t *>(this->memory(1));
+
+    const auto &jcp = conf_.jcp_;
+    const auto &p = plan_;
+    const int icp = jcp.ic_padded, ocp = jcp.oc_padded;
+    const int oc2 = 2 * ocp;
+    const size_t w_size = jcp.w_ld;
+    const int KHW = jcp.kh * jcp.kw;
+
+    float *dW = fft_diff_wei_;
+    float *X = ws_;
+    float *DY = X + (size_t)jcp.nbins * jcp.x_ld;
+    float *scratch = DY + (size_t)jcp.nbins * jcp.y_ld;
+    const size_t scratch_size = tile_scratch_size(jcp);
+
+    for (int g = 0; g < jcp.ngroups; ++g) {
+        parallel_nd(jcp.nbins, [&](int f) {
+            array_set(dW + f * w_size, 0.f, w_size);
+        });
+
+        /* dW[f] += sum_tiles X[f] conj(dY[f]) as a real product of
+         * [re dy, -im dy; im dy, re dy] with [re x, im x] of the tiles,
+         * which gives [re; im] of the result */
+        for (int tblk = 0; tblk < jcp.nb_tile_blocks; ++tblk) {
+            const int tile_start = tblk * jcp.tile_block;
+            const int nt = nstl::min(jcp.ntiles - tile_start,
+                    jcp.tile_block);
+
+            parallel(0, [&](const int ithr, const int nthr) {
+                float *s = scratch + ithr * scratch_size;
+                float *y = s, *Fr = y + jcp.th * jcp.tw * simd_w;
+                float *Fi = Fr + jcp.nbins * simd_w;
+                float *z = Fi + jcp.nbins * simd_w;
+
+                const int nb_ic = icp / simd_w, nb_oc = ocp / simd_w;
+                const int work_amount = nt * (nb_ic + nb_oc);
+                int start{0}, end{0};
+                balance211(work_amount, nthr, ithr, start, end);
+
+                for (int iwork = start; iwork < end; ++iwork) {
+                    const int t = iwork / (nb_ic + nb_oc);
+                    const int cb = iwork % (nb_ic + nb_oc);
+                    if (cb < nb_ic) {
+                        src_transform_tile(jcp, p, src, g, tile_start + t,
+                                cb * simd_w, X, t, s);
+                        continue;
+                    }
+
+                    /* the zero padded diff_dst of a tile */
+                    const int o0 = (cb - nb_ic) * simd_w;
+                    int n, y0, x0;
+                    tile_coords(jcp, tile_start + t, n, y0, x0);
+                    const int i_e = nstl::min(jcp.bh, jcp.oh - y0);
+                    const int j_e = nstl::min(jcp.bw, jcp.ow - x0);
+                    array_set(y, 0.f, (size_t)i_e * jcp.tw * simd_w);
+                    for (int v = 0; v < simd_w; ++v) {
+                        const int o = o0 + v;
+                        if (o >= jcp.oc) break;
+                        const float *d = diff_dst + ((size_t)n * jcp.ngroups
+                                * jcp.oc + g * jcp.oc + o) * jcp.oh * jcp.ow;
+                        for (int i = 0; i < i_e; ++i)
+                        for (int j = 0; j < j_e; ++j)
+                            y[(i * jcp.tw + j) * simd_w + v]
+                                = d[(y0 + i) * jcp.ow + x0 + j];
+                    }
+                    rfft2d(p, y, i_e, Fr, Fi, z);
+                    for (int f = 0; f < jcp.nbins; ++f) {
+                        float *dr = &DY[(size_t)f * jcp.y_ld + t * 2 * oc2
+                            + o0];
+                        float *di = dr + oc2;
+                        PRAGMA_OMP_SIMD()
+                        for (int v = 0; v < simd_w; ++v) {
+                            dr[v] = Fr[f * simd_w + v];
+                            dr[ocp + v] = -Fi[f * simd_w + v];
+                            di[v] = Fi[f * simd_w + v];
+                            di[ocp + v] = Fr[f * simd_w + v];
+                        }
+                    }
+                }
+            });
+
+            parallel_nd(jcp.nbins, [&](int f) {
+                const float one = 1.f;
+                const int nt2 = 2 * nt;
+                extended_sgemm("N", "T", &oc2, &icp, &nt2, &one,
+                        DY + (size_t)f * jcp.y_ld, &oc2,
+                        X + (size_t)f * jcp.x_ld, &icp,
+                        &one, dW + f * w_size, &oc2);
+            });
+        }
+
+        /* the correlation of src with diff_dst back from its spectrum */
+        const float scale = 2.f / (jcp.th * jcp.tw);
+        parallel(0, [&](const int ithr, const int nthr) {
+            float *s = scratch + ithr * scratch_size;
+            float *y = s, *Fr = y + jcp.th * jcp.tw * simd_w;
+            float *Fi = Fr + jcp.nbins * simd_w;
+            float *z = Fi + jcp.nbins * simd_w;
+
+            const int nb_ic = icp / simd_w;
+            int start{0}, end{0};
+            balance211(jcp.oc * nb_ic, nthr, ithr, start, end);
+
+            for (int iwork = start; iwork < end; ++iwork) {
+                const int o = iwork / nb_ic, c0 = (iwork % nb_ic) * simd_w;
+                for (int f = 0; f < jcp.nbins; ++f) {
+                    const float *d = dW + f * w_size;
+                    for (int v = 0; v < simd_w; ++v) {
+                        const size_t col = (size_t)(c0 + v) * oc2;
+                        Fr[f * simd_w + v] = d[col + o];
+                        Fi[f * simd_w + v] = d[col + ocp + o];
+                    }
+                }
+                irfft2d(p, Fr, Fi, jcp.kh, y, z);
+
+                for (int v = 0; v < simd_w; ++v) {
+                    const int c = c0 + v;
+                    if (c >= jcp.ic) break;
+                    float *dw = diff_weights
+                        + ((size_t)(g * jcp.oc + o) * jcp.ic + c) * KHW;
+                    for (int i = 0; i < jcp.kh; ++i)
+                    for (int j = 0; j < jcp.kw; ++j)
+                        dw[i * jcp.kw + j]
+                            = scale * y[(i * jcp.tw + j) * simd_w + v];
+                }
+            }
+        });
+    }
+
+    if (jcp.with_bias) {
+        const int OC = jcp.ngroups * jcp.oc;
+        const size_t OHW = (size_t)jcp.oh * jcp.ow;
+        parallel_nd(OC, [&](int oc) {
+            float db = 0.f;
+            for (int n = 0; n < jcp.mb; ++n) {
+                const float *d = diff_dst + ((size_t)n * OC + oc) * OHW;
+                PRAGMA_OMP_SIMD(reduction(+:db))
+                for (size_t hw = 0; hw < OHW; ++hw)
+                    db += d[hw];
+            }
+            diff_bias[oc] = db;
+        });
+    }
+}
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
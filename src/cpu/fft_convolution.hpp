@@ -0,0 +1,409 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_FFT_CONVOLUTION_HPP
+#define CPU_FFT_CONVOLUTION_HPP
+
+#include "c_types_map.hpp"
+#include "cpu_convolution_pd.hpp"
+#include "cpu_engine.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/* FFT convolution for stride 1 convolutions with large kernels (5x5 and
+ * above, long 1D filters), plain ncw / nchw data.
+ *
+ * The output is split in tiles of bh x bw pixels. The input window of a
+ * tile, th x tw = (bh + kh - 1) x (bw + kw - 1) with th and tw powers of 2,
+ * goes through a real-to-complex 2D FFT; the circular correlation of such a
+ * window with the zero padded kernel gives the bh x bw outputs of the tile
+ * without wrap-around. In the frequency domain the convolution is one
+ * complex matrix product per frequency bin f:
+ *     Y[f][tile][oc] = sum_ic X[f][tile][ic] * conj(W[f][ic][oc])
+ * computed as one real sgemm of the [re; im] weights with the real and
+ * imaginary parts of the input, combined on the way to the inverse
+ * transform. The transforms work on 8 channels at a time.
+ *
+ * Backward by data reuses the data pass over diff_dst with the kernel
+ * rotated by 180 degrees; backward by weights accumulates
+ * sum_tiles X[f] conj(dY[f]) per bin and transforms the result back. */
+struct fft_conv_conf_t {
+    int ndims;
+    int mb, ngroups;
+    /* channels of a group at the input and at the output of the data pass,
+     * for backward by data these are oc and ic; the padded values are
+     * rounded up to the simd width */
+    int ic, oc, ic_padded, oc_padded;
+    int ih, iw, oh, ow;
+    int kh, kw;
+    int t_pad, l_pad;
+    int th, tw; /* transform size */
+    int bh, bw; /* outputs of a tile */
+    int tiles_h, tiles_w, ntiles; /* ntiles is per group */
+    int nbins; /* th * (tw / 2 + 1) */
+    int tile_block, nb_tile_blocks;
+    /* distances between the bins of X[f][tile][2][ic],
+     * Y[f][tile][2][2][oc] and W[f][ic][2][oc] */
+    int x_ld, y_ld, w_ld;
+    bool with_bias, with_sum, with_relu;
+    float relu_negative_slope;
+};
+
+/* bit reversal permutation and twiddle factors exp(-2 pi i k / n) of a
+ * radix-2 complex transform of size n */
+struct fft_plan_1d_t {
+    enum { max_n = 256 };
+    int n;
+    int bitrev[max_n];
+    float wr[max_n / 2], wi[max_n / 2];
+};
+
+struct fft_plan_t {
+    fft_plan_1d_t col; /* size th */
+    fft_plan_1d_t row; /* size tw / 2 */
+    /* exp(-2 pi i k / tw), k = 0 .. tw / 2, to split the spectrum of a real
+     * row packed as a complex one of half the size */
+    float rr[fft_plan_1d_t::max_n + 1], ri[fft_plan_1d_t::max_n + 1];
+};
+
+namespace fft_convolution_utils {
+
+status_t init_conf(fft_conv_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &dst_d,
+        const primitive_attr_t &attr, bool with_relu = false,
+        float relu_negative_slope = 0.f);
+
+void init_plan(const fft_conv_conf_t &jcp, fft_plan_t &plan);
+
+/* flops of the direct method per flop of the fft one, transforms included */
+float speedup(const fft_conv_conf_t &jcp);
+
+/* memory a primitive allocates: the transformed weights and the work
+ * spaces of the threads */
+size_t scratchpad_size(const fft_conv_conf_t &jcp, bool bwd_weights);
+
+}
+
+template <bool with_relu>
+struct _fft_convolution_fwd_t: public cpu_primitive_t {
+    struct pd_t: public _cpu_convolution_fwd_pd_t<with_relu> {
+        pd_t(engine_t *engine,
+                const typename pd_t::base_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : _cpu_convolution_fwd_pd_t<with_relu>(engine, adesc, attr,
+                    hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T("fft:any", _fft_convolution_fwd_t<with_relu>);
+
+        virtual status_t init() override {
+            using namespace prop_kind;
+            assert(this->engine()->kind() == engine_kind::cpu);
+
+            bool ok = true
+                && utils::one_of(this->cdesc_().src_desc.ndims, 3, 4)
+                && this->set_default_params() == status::success
+                && utils::one_of(this->cdesc_().prop_kind, forward_training,
+                        forward_inference)
+                && this->cdesc_().alg_kind == alg_kind::convolution_fft
+                && !this->has_zero_dim_memory()
+                && utils::everyone_is(data_type::f32,
+                        this->cdesc_().src_desc.data_type,
+                        this->cdesc_().weights_desc.data_type,
+                        this->cdesc_().dst_desc.data_type)
+                && utils::implication(this->with_bias(), data_type::f32
+                        == this->cdesc_().bias_desc.data_type)
+                && this->src_pd_.desc()->format == src_format()
+                && this->dst_pd_.desc()->format == src_format()
+                && this->weights_pd_.desc()->format == wei_format()
+                && this->is_fft_post_ops();
+            if (!ok) return status::unimplemented;
+
+            return fft_convolution_utils::init_conf(jcp_, this->cdesc_(),
+                    &this->src_pd_, &this->dst_pd_, *this->attr(), with_relu,
+                    this->negative_slope());
+        }
+
+        fft_conv_conf_t jcp_;
+
+        virtual double efficiency() const override
+        { return 0.2 * fft_convolution_utils::speedup(jcp_); }
+        virtual size_t scratchpad_size() const override {
+            return fft_convolution_utils::scratchpad_size(jcp_, false);
+        }
+
+    protected:
+        memory_format_t src_format() const {
+            using namespace memory_format;
+            return this->cdesc_().src_desc.ndims == 3 ? ncw : nchw;
+        }
+
+        memory_format_t wei_format() const {
+            using namespace memory_format;
+            return this->cdesc_().src_desc.ndims == 3
+                ? (this->with_groups() ? goiw : oiw)
+                : (this->with_groups() ? goihw : oihw);
+        }
+
+        virtual status_t set_default_params() override {
+            using namespace memory_format;
+            if (this->src_pd_.desc()->format == any)
+                CHECK(this->src_pd_.set_format(src_format()));
+            if (this->dst_pd_.desc()->format == any)
+                CHECK(this->dst_pd_.set_format(src_format()));
+            if (this->weights_pd_.desc()->format == any)
+                CHECK(this->weights_pd_.set_format(wei_format()));
+            if (this->bias_pd_.desc()->format == any)
+                CHECK(this->bias_pd_.set_format(x));
+            return status::success;
+        }
+
+        bool is_fft_post_ops() const {
+            auto const &po = this->attr()->post_ops_;
+            switch (po.len_) {
+            case 0: return true;
+            case 1: return po.entry_[0].is_relu() || po.entry_[0].is_sum();
+            case 2: return po.entry_[0].is_sum() && po.entry_[1].is_relu();
+            default: return false;
+            }
+        }
+    };
+
+    _fft_convolution_fwd_t(const pd_t *pd, const input_vector &inputs,
+            const output_vector &outputs);
+    ~_fft_convolution_fwd_t();
+
+    typedef typename prec_traits<data_type::f32>::type data_t;
+
+    virtual void execute(event_t *e) {
+        execute_forward();
+        e->set_state(event_t::ready);
+    }
+
+private:
+    void execute_forward();
+    pd_t conf_;
+
+    fft_plan_t plan_;
+    data_t *fft_wei_; /* W[g][f][2 ic][2 oc] */
+    size_t ws_per_thread_;
+    data_t *ws_;
+};
+
+using fft_convolution_fwd_t = _fft_convolution_fwd_t<false>;
+using fft_convolution_relu_t = _fft_convolution_fwd_t<true>;
+
+struct fft_convolution_bwd_data_t: public cpu_primitive_t {
+    struct pd_t: public cpu_convolution_bwd_data_pd_t {
+        pd_t(engine_t *engine,
+                const convolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_bwd_data_pd_t(engine, adesc, attr, hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T("fft:any", fft_convolution_bwd_data_t);
+
+        virtual status_t init() override {
+            assert(this->engine()->kind() == engine_kind::cpu);
+
+            bool ok = true
+                && utils::one_of(this->desc()->diff_src_desc.ndims, 3, 4)
+                && this->set_default_params() == status::success
+                && this->desc()->prop_kind == prop_kind::backward_data
+                && this->desc()->alg_kind == alg_kind::convolution_fft
+                && !this->has_zero_dim_memory()
+                && utils::everyone_is(data_type::f32,
+                        this->desc()->diff_src_desc.data_type,
+                        this->desc()->weights_desc.data_type,
+                        this->desc()->diff_dst_desc.data_type)
+                && this->diff_src_pd_.desc()->format == src_format()
+                && this->diff_dst_pd_.desc()->format == src_format()
+                && this->weights_pd_.desc()->format == wei_format();
+            if (!ok) return status::unimplemented;
+
+            return fft_convolution_utils::init_conf(jcp_, *this->desc(),
+                    &this->diff_src_pd_, &this->diff_dst_pd_, *this->attr());
+        }
+
+        fft_conv_conf_t jcp_;
+
+        virtual double efficiency() const override
+        { return 0.2 * fft_convolution_utils::speedup(jcp_); }
+        virtual size_t scratchpad_size() const override {
+            return fft_convolution_utils::scratchpad_size(jcp_, false);
+        }
+
+    protected:
+        memory_format_t src_format() const {
+            using namespace memory_format;
+            return this->desc()->diff_src_desc.ndims == 3 ? ncw : nchw;
+        }
+
+        memory_format_t wei_format() const {
+            using namespace memory_format;
+            return this->desc()->diff_src_desc.ndims == 3
+                ? (this->with_groups() ? goiw : oiw)
+                : (this->with_groups() ? goihw : oihw);
+        }
+
+        virtual status_t set_default_params() override {
+            using namespace memory_format;
+            if (this->diff_src_pd_.desc()->format == any)
+                CHECK(this->diff_src_pd_.set_format(src_format()));
+            if (this->diff_dst_pd_.desc()->format == any)
+                CHECK(this->diff_dst_pd_.set_format(src_format()));
+            if (this->weights_pd_.desc()->format == any)
+                CHECK(this->weights_pd_.set_format(wei_format()));
+            return status::success;
+        }
+    };
+
+    fft_convolution_bwd_data_t(const pd_t *pd,
+            const input_vector &inputs, const output_vector &outputs);
+    ~fft_convolution_bwd_data_t();
+
+    typedef typename prec_traits<data_type::f32>::type data_t;
+
+    virtual void execute(event_t *e) {
+        switch (conf_.desc()->prop_kind) {
+        case prop_kind::backward_data:
+            execute_backward_data();
+            break;
+        default:
+            assert(!"invalid prop_kind");
+        }
+        e->set_state(event_t::ready);
+    }
+
+private:
+    void execute_backward_data();
+    pd_t conf_;
+
+    fft_plan_t plan_;
+    data_t *fft_wei_; /* W[g][f][2 oc][2 ic] of the rotated kernel */
+    size_t ws_per_thread_;
+    data_t *ws_;
+};
+
+struct fft_convolution_bwd_weights_t: public cpu_primitive_t {
+    struct pd_t: public cpu_convolution_bwd_weights_pd_t {
+        pd_t(engine_t *engine,
+                const convolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_bwd_weights_pd_t(engine, adesc, attr,
+                    hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T("fft:any", fft_convolution_bwd_weights_t);
+
+        virtual status_t init() override {
+            assert(this->engine()->kind() == engine_kind::cpu);
+
+            bool ok = true
+                && utils::one_of(this->desc()->src_desc.ndims, 3, 4)
+                && this->set_default_params() == status::success
+                && this->desc()->prop_kind == prop_kind::backward_weights
+                && this->desc()->alg_kind == alg_kind::convolution_fft
+                && !this->has_zero_dim_memory()
+                && utils::everyone_is(data_type::f32,
+                        this->desc()->src_desc.data_type,
+                        this->desc()->diff_weights_desc.data_type,
+                        this->desc()->diff_dst_desc.data_type)
+                && utils::implication(this->with_bias(), data_type::f32
+                        == this->desc()->diff_bias_desc.data_type)
+                && this->src_pd_.desc()->format == src_format()
+                && this->diff_dst_pd_.desc()->format == src_format()
+                && this->diff_weights_pd_.desc()->format == wei_format();
+            if (!ok) return status::unimplemented;
+
+            return fft_convolution_utils::init_conf(jcp_, *this->desc(),
+                    &this->src_pd_, &this->diff_dst_pd_, *this->attr());
+        }
+
+        fft_conv_conf_t jcp_;
+
+        virtual double efficiency() const override
+        { return 0.12 * fft_convolution_utils::speedup(jcp_); }
+        virtual size_t scratchpad_size() const override {
+            return fft_convolution_utils::scratchpad_size(jcp_, true);
+        }
+
+    protected:
+        memory_format_t src_format() const {
+            using namespace memory_format;
+            return this->desc()->src_desc.ndims == 3 ? ncw : nchw;
+        }
+
+        memory_format_t wei_format() const {
+            using namespace memory_format;
+            return this->desc()->src_desc.ndims == 3
+                ? (this->with_groups() ? goiw : oiw)
+                : (this->with_groups() ? goihw : oihw);
+        }
+
+        virtual status_t set_default_params() override {
+            using namespace memory_format;
+            if (this->src_pd_.desc()->format == any)
+                CHECK(this->src_pd_.set_format(src_format()));
+            if (this->diff_dst_pd_.desc()->format == any)
+                CHECK(this->diff_dst_pd_.set_format(src_format()));
+            if (this->diff_weights_pd_.desc()->format == any)
+                CHECK(this->diff_weights_pd_.set_format(wei_format()));
+            if (this->diff_bias_pd_.desc()->format == any)
+                CHECK(this->diff_bias_pd_.set_format(x));
+            return status::success;
+        }
+    };
+
+    fft_convolution_bwd_weights_t(const pd_t *pd,
+            const input_vector &inputs, const output_vector &outputs);
+    ~fft_convolution_bwd_weights_t();
+
+    typedef typename prec_traits<data_type::f32>::type data_t;
+
+    virtual void execute(event_t *e) {
+        switch (conf_.desc()->prop_kind) {
+        case prop_kind::backward_weights:
+            execute_backward_weights();
+            break;
+        default:
+            assert(!"invalid prop_kind");
+        }
+        e->set_state(event_t::ready);
+    }
+
+private:
+    void execute_backward_weights();
+    pd_t conf_;
+
+    fft_plan_t plan_;
+    data_t *fft_diff_wei_; /* dW[f][2 ic][2 oc] of one group */
+    data_t *ws_;
+};
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
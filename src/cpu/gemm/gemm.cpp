@@ -17,6 +17,7 @@
 
 #include "mkldnn.h"
 
+#include "mkldnn_thread.hpp"
 #include "verbose.hpp"
 
 #include "jit_avx_gemm_f32.hpp"
@@ -88,19 +89,23 @@ struct gemm_impl_t {
     mkldnn_status_t call(const char *transa, const char *transb, const int *M,
             const int *N, const int *K, const float *alpha, const float *A,
             const int *lda, const float *B, const int *ldb, const float *beta,
-            float *C, const int *ldc, const float *bias = nullptr) {
+            float *C, const int *ldc, const float *bias = nullptr,
+            const sgemm_post_ops_t *post_ops = nullptr) {
         switch (isa_) {
             case avx:
                 ((jit_avx_gemm_f32*)ker_)->sgemm(transa, transb, M, N, K,
-                    alpha, A, lda, B, ldb, beta, C, ldc, bias);
+                    alpha, A, lda, B, ldb, beta, C, ldc, bias, post_ops);
                 break;
             case avx512_common:
                 ((jit_avx512_common_gemm_f32*)ker_)->sgemm(transa, transb,
-                    M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, bias);
+                    M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, bias,
+                    post_ops);
                 break;
             default:
                 ref_gemm(transa, transb, M, N, K, alpha, A, lda, B, ldb, beta,
                         C, ldc, bias);
+                if (post_ops)
+                    post_ops->apply(*M, *N, C, *ldc, 0, 0);
                 break;
         }
         return mkldnn_success;
@@ -132,10 +137,10 @@ mkldnn_status_t extended_sgemm(const char *transa, const char *transb,
         const int *M, const int *N, const int *K, const float *alpha,
         const float *A, const int *lda, const float *B, const int *ldb,
         const float *beta, float *C, const int *ldc,
-        const float *bias, const bool force_jit_gemm) {
+        const sgemm_post_ops_t &post_ops, const bool force_jit_gemm) {
     //Check input
     mkldnn_status_t status = check_gemm_input(transa, transb, M, N, K,
-            lda, ldb, ldc, alpha, beta, bias != nullptr);
+            lda, ldb, ldc, alpha, beta, false);
     if (status != mkldnn_success)
         return status;
     if (*M == 0 || *N == 0 || *K == 0)
@@ -149,17 +154,22 @@ mkldnn_status_t extended_sgemm(const char *transa, const char *transb,
         CBLAS_TRANSPOSE Cblas_trB = trB ? CblasTrans : CblasNoTrans;
         cblas_sgemm(CblasColMajor, Cblas_trA, Cblas_trB,
                 *M, *N, *K, *alpha, A, *lda, B, *ldb, *beta, C, *ldc);
-        //Add bias if necessary (bias is applied to columns of C)
-        if (bias) {
-            cblas_int incx = 1, incy = 1;
+        //Apply post-ops if necessary (column by column)
+        if (!post_ops.has_default_values()) {
             parallel_nd(*N, [&](int n) {
-                cblas_saxpy(*M, 1.0, bias, incx, C + n*(*ldc), incy);
+                post_ops.apply(*M, 1, C + (size_t)n * (*ldc), *ldc, 0, n);
             });
         }
         return mkldnn_success;
     }
 #endif
-    //Generate jit kernel and call sgemm with bias
+    //Tiny matrices do not need blocking, copying or threading
+    if (small_sgemm(transa, transb, M, N, K, alpha, A, lda, B, ldb, beta,
+                C, ldc, post_ops.has_default_values() ? nullptr : &post_ops)
+            == mkldnn_success)
+        return mkldnn_success;
+
+    //Generate jit kernel and call sgemm with post-ops
     volatile static int initialized = 0;
     if (!initialized) {
         static std::mutex mtx;
@@ -169,17 +179,265 @@ mkldnn_status_t extended_sgemm(const char *transa, const char *transb,
             initialized = 1;
         }
     }
-    if (bias)
+    if (post_ops.bias_kind == sgemm_post_ops_t::bias_per_row
+            && *beta == 0.f) {
+        //Per-row bias with zero beta is added by the jit kernel itself
+        sgemm_post_ops_t rest = post_ops;
+        rest.bias_kind = sgemm_post_ops_t::bias_none;
+        rest.bias = nullptr;
         gemm_bias_impl[trA][trB]->call(
                 transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc,
-                bias);
-    else
+                post_ops.bias, rest.has_default_values() ? nullptr : &rest);
+    } else {
         gemm_impl[*beta == 0.f][trA][trB]->call(
-                transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+                transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc,
+                nullptr, post_ops.has_default_values() ? nullptr : &post_ops);
+    }
 
     return mkldnn_success;
 }
 
+mkldnn_status_t extended_sgemm(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *alpha,
+        const float *A, const int *lda, const float *B, const int *ldb,
+        const float *beta, float *C, const int *ldc,
+        const float *bias, const bool force_jit_gemm) {
+    //Check input
+    mkldnn_status_t status = check_gemm_input(transa, transb, M, N, K,
+            lda, ldb, ldc, alpha, beta, bias != nullptr);
+    if (status != mkldnn_success)
+        return status;
+
+    sgemm_post_ops_t post_ops;
+    if (bias) {
+        post_ops.bias = bias;
+        post_ops.bias_kind = sgemm_post_ops_t::bias_per_row;
+    }
+    return extended_sgemm(transa, transb, M, N, K, alpha, A, lda, B, ldb,
+            beta, C, ldc, post_ops, force_jit_gemm);
+}
+
+mkldnn_status_t sgemm_team(int ithr, int nthr, sgemm_partition_t partition,
+        const char *transa, const char *transb, const int *M, const int *N,
+        const int *K, const float *alpha, const float *A, const int *lda,
+        const float *B, const int *ldb, const float *beta, float *C,
+        const int *ldc, const sgemm_post_ops_t &post_ops) {
+    if (nthr == 1)
+        return extended_sgemm(transa, transb, M, N, K, alpha, A, lda, B, ldb,
+                beta, C, ldc, post_ops);
+
+    mkldnn_status_t status = check_gemm_input(transa, transb, M, N, K,
+            lda, ldb, ldc, alpha, beta, false);
+    if (status != mkldnn_success)
+        return status;
+
+    /* M is split in units of the kernels' M unroll */
+    const int m_unit = 16;
+    const int m_units = utils::div_up(*M, m_unit);
+
+    int nthr_m = 1, nthr_n = 1;
+    switch (partition) {
+    case sgemm_partition_m: nthr_m = nthr; break;
+    case sgemm_partition_n: nthr_n = nthr; break;
+    default:
+        /* the 2D grid with the smallest block perimeter: it minimizes the
+         * parts of A and B each thread has to read */
+        int best = -1;
+        for (int d = 1; d <= nthr; d++) {
+            if (nthr % d != 0) continue;
+            int cost = utils::div_up(m_units, d) * m_unit
+                + utils::div_up(*N, nthr / d);
+            if (best < 0 || cost < best) {
+                best = cost;
+                nthr_m = d;
+                nthr_n = nthr / d;
+            }
+        }
+    }
+
+    int ithr_m = ithr % nthr_m, ithr_n = ithr / nthr_m;
+    if (ithr_n >= nthr_n)
+        return mkldnn_success;
+
+    int m_from = 0, m_to = 0, n_from = 0, n_to = 0;
+    balance211(m_units, nthr_m, ithr_m, m_from, m_to);
+    balance211(*N, nthr_n, ithr_n, n_from, n_to);
+    m_from *= m_unit;
+    m_to = nstl::min(m_to * m_unit, *M);
+
+    const int myM = m_to - m_from, myN = n_to - n_from;
+    if (myM <= 0 || myN <= 0)
+        return mkldnn_success;
+
+    const bool trA = utils::one_of(*transa, 'T', 't');
+    const bool trB = utils::one_of(*transb, 'T', 't');
+    const float *myA = A + (trA ? (size_t)m_from * *lda : m_from);
+    const float *myB = B + (trB ? n_from : (size_t)n_from * *ldb);
+    float *myC = C + m_from + (size_t)n_from * *ldc;
+
+    sgemm_post_ops_t my_post_ops = post_ops;
+    if (post_ops.bias_kind == sgemm_post_ops_t::bias_per_row)
+        my_post_ops.bias += m_from;
+    else if (post_ops.bias_kind == sgemm_post_ops_t::bias_per_col)
+        my_post_ops.bias += n_from;
+
+    return extended_sgemm(transa, transb, &myM, &myN, K, alpha, myA, lda,
+            myB, ldb, beta, myC, ldc, my_post_ops);
+}
+
+namespace {
+/* Packed buffer: a 64-byte header followed (at the next 64-byte boundary)
+ * by the matrix in column-major non-transposed form. */
+struct gemm_pack_header_t {
+    unsigned magic;
+    char identifier;
+    int nrows, ncols, ld;
+    size_t data_offset;
+};
+
+const unsigned gemm_pack_magic = 0x6b636170; // "pack"
+const size_t gemm_pack_header_size = 64;
+const size_t gemm_pack_alignment = 64;
+
+inline bool is_trans(const char *trans) {
+    return utils::one_of(*trans, 'T', 't');
+}
+inline bool is_packed(const char *trans) {
+    return utils::one_of(*trans, 'P', 'p');
+}
+
+/* Leading dimension of the packed matrix: a multiple of the avx512 vector
+ * length, but never a multiple of the page size to avoid 4K aliasing
+ * between columns */
+inline int pack_ld(int nrows) {
+    int ld = utils::rnd_up(nstl::max(nrows, 1), 16);
+    if ((ld * sizeof(float)) % PAGE_4K == 0) ld += 16;
+    return ld;
+}
+
+mkldnn_status_t pack_dims(const char *identifier, const char *transa,
+        const char *transb, const int *M, const int *N, const int *K,
+        int &nrows, int &ncols, bool &trans) {
+    if (utils::any_null(identifier, transa, transb, M, N, K))
+        return invalid_arguments;
+    if (*M < 0 || *N < 0 || *K < 0) return invalid_arguments;
+    if (utils::one_of(*identifier, 'A', 'a')) {
+        if (!utils::one_of(*transa, 'T', 't', 'N', 'n'))
+            return invalid_arguments;
+        nrows = *M; ncols = *K; trans = is_trans(transa);
+    } else if (utils::one_of(*identifier, 'B', 'b')) {
+        if (!utils::one_of(*transb, 'T', 't', 'N', 'n'))
+            return invalid_arguments;
+        nrows = *K; ncols = *N; trans = is_trans(transb);
+    } else {
+        return invalid_arguments;
+    }
+    return success;
+}
+
+const gemm_pack_header_t *get_pack_header(const float *packed,
+        char identifier, int nrows, int ncols) {
+    auto hdr = reinterpret_cast<const gemm_pack_header_t *>(packed);
+    bool ok = true
+        && hdr->magic == gemm_pack_magic
+        && hdr->identifier == identifier
+        && hdr->nrows == nrows
+        && hdr->ncols == ncols;
+    return ok ? hdr : nullptr;
+}
+}
+
+mkldnn_status_t sgemm_pack_get_size(const char *identifier,
+        const char *transa, const char *transb, const int *M, const int *N,
+        const int *K, size_t *size) {
+    if (size == nullptr) return invalid_arguments;
+    int nrows, ncols;
+    bool trans;
+    mkldnn_status_t status = pack_dims(identifier, transa, transb, M, N, K,
+            nrows, ncols, trans);
+    if (status != success) return status;
+
+    *size = gemm_pack_header_size + gemm_pack_alignment
+        + sizeof(float) * pack_ld(nrows) * nstl::max(ncols, 1);
+    return success;
+}
+
+mkldnn_status_t sgemm_pack(const char *identifier, const char *transa,
+        const char *transb, const int *M, const int *N, const int *K,
+        const float *alpha, const float *src, const int *ld, float *dst) {
+    if (utils::any_null(alpha, src, ld, dst)) return invalid_arguments;
+    int nrows, ncols;
+    bool trans;
+    mkldnn_status_t status = pack_dims(identifier, transa, transb, M, N, K,
+            nrows, ncols, trans);
+    if (status != success) return status;
+    if (*ld < nstl::max(1, trans ? ncols : nrows)) return invalid_arguments;
+
+    const size_t data_start = utils::rnd_up(
+            (size_t)dst + gemm_pack_header_size, gemm_pack_alignment);
+
+    auto hdr = reinterpret_cast<gemm_pack_header_t *>(dst);
+    hdr->magic = gemm_pack_magic;
+    hdr->identifier = utils::one_of(*identifier, 'A', 'a') ? 'A' : 'B';
+    hdr->nrows = nrows;
+    hdr->ncols = ncols;
+    hdr->ld = pack_ld(nrows);
+    hdr->data_offset = data_start - (size_t)dst;
+
+    float *pdst = reinterpret_cast<float *>(data_start);
+    const int ld_src = *ld, ld_dst = hdr->ld;
+    const float a = *alpha;
+    parallel_nd(ncols, [&](int j) {
+        float *d = &pdst[(size_t)j * ld_dst];
+        if (trans) {
+            for (int i = 0; i < nrows; ++i)
+                d[i] = a * src[j + (size_t)i * ld_src];
+        } else {
+            const float *s = &src[(size_t)j * ld_src];
+            PRAGMA_OMP_SIMD()
+            for (int i = 0; i < nrows; ++i)
+                d[i] = a * s[i];
+        }
+        for (int i = nrows; i < ld_dst; ++i)
+            d[i] = 0.f;
+    });
+
+    return success;
+}
+
+mkldnn_status_t sgemm_compute(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *A,
+        const int *lda, const float *B, const int *ldb, const float *beta,
+        float *C, const int *ldc, const float *bias, bool force_jit_gemm) {
+    if (utils::any_null(transa, transb, M, N, K, A, B))
+        return invalid_arguments;
+
+    const float one = 1.0f;
+    const char *op_a = transa, *op_b = transb;
+    const int *ld_a = lda, *ld_b = ldb;
+
+    if (is_packed(transa)) {
+        auto hdr = get_pack_header(A, 'A', *M, *K);
+        if (hdr == nullptr) return invalid_arguments;
+        A = reinterpret_cast<const float *>(
+                reinterpret_cast<const char *>(A) + hdr->data_offset);
+        op_a = "N";
+        ld_a = &hdr->ld;
+    }
+    if (is_packed(transb)) {
+        auto hdr = get_pack_header(B, 'B', *K, *N);
+        if (hdr == nullptr) return invalid_arguments;
+        B = reinterpret_cast<const float *>(
+                reinterpret_cast<const char *>(B) + hdr->data_offset);
+        op_b = "N";
+        ld_b = &hdr->ld;
+    }
+
+    /* alpha has been applied at packing time */
+    return extended_sgemm(op_a, op_b, M, N, K, &one, A, ld_a, B, ld_b, beta,
+            C, ldc, bias, force_jit_gemm);
+}
+
 }
 }
 }
@@ -194,3 +452,24 @@ mkldnn_status_t mkldnn_sgemm(const char *transa, const char *transb,
     return extended_sgemm(
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
+
+mkldnn_status_t mkldnn_sgemm_pack_get_size(const char *identifier,
+        const char *transa, const char *transb, const int *M, const int *N,
+        const int *K, size_t *size) {
+    return sgemm_pack_get_size(identifier, transa, transb, M, N, K, size);
+}
+
+mkldnn_status_t mkldnn_sgemm_pack(const char *identifier, const char *transa,
+        const char *transb, const int *M, const int *N, const int *K,
+        const float *alpha, const float *src, const int *ld, float *dst) {
+    return sgemm_pack(identifier, transa, transb, M, N, K, alpha, src, ld,
+            dst);
+}
+
+mkldnn_status_t mkldnn_sgemm_compute(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *A,
+        const int *lda, const float *B, const int *ldb, const float *beta,
+        float *C, const int *ldc) {
+    return sgemm_compute(transa, transb, M, N, K, A, lda, B, ldb, beta, C,
+            ldc);
+}
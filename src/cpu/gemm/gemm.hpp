@@ -15,18 +15,97 @@
 *******************************************************************************/
 #ifndef GEMM_HPP
 #define GEMM_HPP
+
+#include "mkldnn_types.h"
+
 namespace mkldnn {
 namespace impl {
 namespace cpu {
+
+/* Post-operations fused into the gemm: they are applied by the drivers to
+ * each block of C right after its last K-block is computed, while the block
+ * is still hot in cache, instead of in a separate sweep over C.
+ *   C := post_ops(alpha*op(A)*op(B) + beta*C)
+ * - bias is added per row (indexed by m) or per column (indexed by n)
+ * - relu with negative slope is applied after the bias */
+struct sgemm_post_ops_t {
+    enum bias_kind_t { bias_none, bias_per_row, bias_per_col };
+
+    sgemm_post_ops_t()
+        : bias(nullptr), bias_kind(bias_none), with_relu(false)
+        , relu_nslope(0.f) {}
+
+    bool has_default_values() const
+    { return bias_kind == bias_none && !with_relu; }
+
+    /* Applies post-ops to the m x n block of C located at (m_off, n_off) */
+    void apply(int m, int n, float *c, int ldc, int m_off, int n_off) const;
+
+    const float *bias;
+    bias_kind_t bias_kind;
+    bool with_relu;
+    float relu_nslope;
+};
+
 mkldnn_status_t extended_sgemm(const char *transa, const char *transb,
         const int *M, const int *N, const int *K, const float *alpha,
         const float *A, const int *lda, const float *B, const int *ldb,
         const float *beta, float *C, const int *ldc,
         const float *bias = nullptr, bool force_jit_gemm = false);
+mkldnn_status_t extended_sgemm(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *alpha,
+        const float *A, const int *lda, const float *B, const int *ldb,
+        const float *beta, float *C, const int *ldc,
+        const sgemm_post_ops_t &post_ops, bool force_jit_gemm = false);
+/* Team sgemm: computes the block of C owned by thread ithr of a team of nthr
+ * threads, which the caller runs (typically a part of its own parallel
+ * region, e.g. the threads assigned to one image). C is split on a 2D
+ * nthr_m x nthr_n grid without splitting K, so the threads of the team do not
+ * synchronize and each block is computed single-threaded.
+ * - sgemm_partition_m / _n split only the rows / the columns of C, which lets
+ *   the caller prepare only the part of A or B a thread reads
+ * - sgemm_partition_auto picks the grid with the smallest blocks perimeter */
+enum sgemm_partition_t {
+    sgemm_partition_auto,
+    sgemm_partition_m,
+    sgemm_partition_n,
+};
+
+mkldnn_status_t sgemm_team(int ithr, int nthr, sgemm_partition_t partition,
+        const char *transa, const char *transb, const int *M, const int *N,
+        const int *K, const float *alpha, const float *A, const int *lda,
+        const float *B, const int *ldb, const float *beta, float *C,
+        const int *ldc, const sgemm_post_ops_t &post_ops);
+
+/* Single-threaded sgemm for tiny shapes (M, N, K < 64) with shape-specialized
+ * jit kernels, used by extended_sgemm() when the driver overheads would
+ * dominate. Returns mkldnn_unimplemented if the shape is not handled. */
+mkldnn_status_t small_sgemm(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *alpha,
+        const float *A, const int *lda, const float *B, const int *ldb,
+        const float *beta, float *C, const int *ldc,
+        const sgemm_post_ops_t *post_ops);
 void ref_gemm(const char *transa, const char *transb, const int *M,
         const int *N, const int *K, const float *alpha, const float *A,
         const int *lda, const float *B, const int *ldb, const float *beta,
         float *C, const int *ldc, const float *bias);
+
+/* Packed sgemm: one of the matrices (typically the weights) is stored once in
+ * the layout the jit kernels consume best (non-transposed, alpha applied,
+ * 64-byte aligned with a padded leading dimension) and then reused by many
+ * sgemm_compute() calls. The packed buffer is self-describing, so lda/ldb of
+ * the packed operand are ignored by sgemm_compute(). */
+mkldnn_status_t sgemm_pack_get_size(const char *identifier,
+        const char *transa, const char *transb, const int *M, const int *N,
+        const int *K, size_t *size);
+mkldnn_status_t sgemm_pack(const char *identifier, const char *transa,
+        const char *transb, const int *M, const int *N, const int *K,
+        const float *alpha, const float *src, const int *ld, float *dst);
+mkldnn_status_t sgemm_compute(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *A,
+        const int *lda, const float *B, const int *ldb, const float *beta,
+        float *C, const int *ldc, const float *bias = nullptr,
+        bool force_jit_gemm = false);
 #ifdef USE_CBLAS
 #define GEMM_IMPL_STR "gemm:blas"
 #else
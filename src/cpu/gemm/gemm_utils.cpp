@@ -14,9 +14,14 @@
 * limitations under the License.
 *******************************************************************************/
 #include <math.h>
+#include <mutex>
+#include <vector>
 
 #include "mkldnn_thread.hpp"
+#include "nstl.hpp"
 #include "utils.hpp"
+#include "gemm.hpp"
+#include "gemm_utils.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -47,17 +52,15 @@ void calc_nthr_nocopy_avx(int m, int n, int k,
     nthr_n = (n + BN_NOCOPY_AVX - 1) / BN_NOCOPY_AVX;
     nthr_k = 1;
 
-    // Partition along K dimension
-    //  - if threading allows having barriers (e.g. OMP)
-    //  - if there is not enough parallelism along M or N
-    if (mkldnn_thr_syncable()) {
-        int nthr_other = nthr_k = 1;
-        while ((nthr_m * nthr_n * nthr_other < nthr)
-                && (k / (nthr_other + 1) > BK_NOCOPY_AVX)) {
-            nthr_other++;
-            if ((nthr / nthr_other) * nthr_other > 0.9 * nthr)
-                nthr_k = nthr_other;
-        }
+    // Partition along K dimension if there is not enough parallelism along
+    // M or N. The partial results are summed up with barriers if threading
+    // allows having them (e.g. OMP) or in a separate parallel section
+    int nthr_other = 1;
+    while ((nthr_m * nthr_n * nthr_other < nthr)
+            && (k / (nthr_other + 1) > BK_NOCOPY_AVX)) {
+        nthr_other++;
+        if ((nthr / nthr_other) * nthr_other > 0.9 * nthr)
+            nthr_k = nthr_other;
     }
     nthr /= nthr_k;
 
@@ -160,25 +163,23 @@ void calc_nthr_nocopy_avx512_common(int m,
     nthr = nthrs;
     int nthr_m_gt_n;
 
-    // Partition along K dimension
-    //  - if threading allows having barriers (e.g. OMP)
-    //  - if there is not enough parallelism along M or N
-    if (mkldnn_thr_syncable()) {
-        if (n <= 2 * BN_NOCOPY_AVX512_COMMON &&
-                m <= 2 * BM_NOCOPY_AVX512_COMMON * nthr) {
-            nthr_k = k / BK_NOCOPY_AVX512_COMMON;
-            if (nthr_k > nthr / 4)
-                nthr_k = nthr / 4;
-            if (nthr_k < 1)
-                nthr_k = 1;
-
-            while ((nthr_k > 1) && (nthr % nthr_k)) {
-                nthr_k--;
-            }
-            nthr /= nthr_k;
-        } else {
+    // Partition along K dimension if there is not enough parallelism along
+    // M or N. The partial results are summed up with barriers if threading
+    // allows having them (e.g. OMP) or in a separate parallel section
+    if (n <= 2 * BN_NOCOPY_AVX512_COMMON &&
+            m <= 2 * BM_NOCOPY_AVX512_COMMON * nthr) {
+        nthr_k = k / BK_NOCOPY_AVX512_COMMON;
+        if (nthr_k > nthr / 4)
+            nthr_k = nthr / 4;
+        if (nthr_k < 1)
             nthr_k = 1;
+
+        while ((nthr_k > 1) && (nthr % nthr_k)) {
+            nthr_k--;
         }
+        nthr /= nthr_k;
+    } else {
+        nthr_k = 1;
     }
     nthr_m = (m + BM_NOCOPY_AVX512_COMMON - 1) / BM_NOCOPY_AVX512_COMMON;
     nthr_n = (n + BN_NOCOPY_AVX512_COMMON - 1) / BN_NOCOPY_AVX512_COMMON;
@@ -341,6 +342,62 @@ void partition_unit_diff(
     }
 }
 
+namespace {
+const int ws_pool_nclasses = 48;
+const size_t ws_pool_min_size = 4096;
+
+struct ws_pool_t {
+    std::mutex mtx;
+    std::vector<float *> free_bufs[ws_pool_nclasses];
+    size_t heap_allocs = 0;
+};
+
+ws_pool_t &ws_pool() {
+    static ws_pool_t pool;
+    return pool;
+}
+
+int ws_pool_class(size_t size) {
+    int cls = 0;
+    while ((ws_pool_min_size << cls) < size)
+        cls++;
+    return cls;
+}
+}
+
+float *ws_pool_acquire(size_t size) {
+    const int cls = ws_pool_class(size);
+    if (cls >= ws_pool_nclasses)
+        return nullptr;
+
+    auto &pool = ws_pool();
+    {
+        std::lock_guard<std::mutex> lock(pool.mtx);
+        auto &bufs = pool.free_bufs[cls];
+        if (!bufs.empty()) {
+            float *buf = bufs.back();
+            bufs.pop_back();
+            return buf;
+        }
+        pool.heap_allocs++;
+    }
+    return (float *)malloc(ws_pool_min_size << cls, 4096);
+}
+
+void ws_pool_release(float *buf, size_t size) {
+    if (buf == nullptr)
+        return;
+    auto &pool = ws_pool();
+    std::lock_guard<std::mutex> lock(pool.mtx);
+    pool.free_bufs[ws_pool_class(size)].push_back(buf);
+}
+
+size_t ws_pool_heap_allocs() {
+    auto &pool = ws_pool();
+    std::lock_guard<std::mutex> lock(pool.mtx);
+    return pool.heap_allocs;
+}
+
 // Sum the m*n values from p_src into p_dst, assuming the two-dimensional
 // arrays have leading dimensions ld_src and ld_dst, respectively
 void sum_two_matrices(
@@ -353,6 +410,62 @@ void sum_two_matrices(
         }
     }
 }
+
+void sum_k_partitions(int m, int n, int nthr_m, int nthr_n, int nthr_k,
+        int MB, int NB, float *c_buffers, float *c, int ldc,
+        const sgemm_post_ops_t *post_ops)
+{
+    const int nthr_mn = nthr_m * nthr_n;
+    parallel(nthr_mn * nthr_k, [&](const int ithr, const int nthr) {
+        const int ithr_mn = ithr % nthr_mn;
+        const int ithr_m = ithr_mn % nthr_m;
+        const int ithr_n = ithr_mn / nthr_m;
+        const int ithr_k = ithr / nthr_mn;
+        const int cbase = ithr_mn * (nthr_k - 1);
+
+        const int m_from = MB * ithr_m;
+        const int n_from = NB * ithr_n;
+        const int myM = nstl::min(m, m_from + MB) - m_from;
+        const int myN = nstl::min(n, n_from + NB) - n_from;
+        if (myM <= 0 || myN <= 0) return;
+
+        int n1, n2;
+        partition_unit_diff(ithr_k, nthr_k, myN, &n1, &n2);
+        if (n2 <= 0) return;
+
+        float *myC = &c[m_from + (size_t)(n_from + n1) * ldc];
+        for (int ik = 1; ik < nthr_k; ++ik)
+            sum_two_matrices(myM, n2, c_buffers + MB * (NB * (cbase + ik - 1)
+                    + n1), MB, myC, ldc);
+
+        if (post_ops != NULL)
+            post_ops->apply(myM, n2, myC, ldc, m_from, n_from + n1);
+    });
+}
+}
+
+void sgemm_post_ops_t::apply(int m, int n, float *c, int ldc, int m_off,
+        int n_off) const {
+    const float *bias_row
+        = bias_kind == bias_per_row ? bias + m_off : nullptr;
+    for (int j = 0; j < n; j++) {
+        float *c_j = c + (size_t)j * ldc;
+        if (bias_row) {
+            PRAGMA_OMP_SIMD()
+            for (int i = 0; i < m; i++)
+                c_j[i] += bias_row[i];
+        } else if (bias_kind == bias_per_col) {
+            const float b = bias[n_off + j];
+            PRAGMA_OMP_SIMD()
+            for (int i = 0; i < m; i++)
+                c_j[i] += b;
+        }
+        if (with_relu) {
+            PRAGMA_OMP_SIMD()
+            for (int i = 0; i < m; i++)
+                c_j[i] = (c_j[i] < 0) ? c_j[i] * relu_nslope : c_j[i];
+        }
+    }
 }
 }
 }
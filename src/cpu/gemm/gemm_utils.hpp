@@ -17,10 +17,14 @@
 #ifndef GEMM_UTILS_HPP
 #define GEMM_UTILS_HPP
 
+#include <stddef.h>
+
 namespace mkldnn {
 namespace impl {
 namespace cpu {
 
+struct sgemm_post_ops_t;
+
 namespace gemm_utils {
 void sum_two_matrices(
         int m, int n, float *p_src, int ld_src, float *p_dst, int ld_dst);
@@ -35,6 +39,26 @@ void calc_nthr_nocopy_avx(int m, int n, int k,
 
 void partition_unit_diff(
         int ithr, int nthr, int n, int *t_offset, int *t_block);
+
+// Sums the partial results of a GEMM partitioned along K into C in a
+// parallel section of its own, for the threading runtimes without barriers.
+// The partial result of thread ithr_k > 0 of the (ithr_m, ithr_n) block is
+// an MB x NB matrix at c_buffers + MB * NB * (cbase + ithr_k - 1), with
+// cbase = (ithr_m + nthr_m * ithr_n) * (nthr_k - 1). Every thread of the
+// section sums a band of columns of a block and applies the post-ops to it.
+void sum_k_partitions(int m, int n, int nthr_m, int nthr_n, int nthr_k,
+        int MB, int NB, float *c_buffers, float *c, int ldc,
+        const sgemm_post_ops_t *post_ops);
+
+// Workspace pool for the gemm drivers: buffers are kept in power-of-two size
+// classes and recycled between calls, so that the steady state (the same
+// shapes called over and over) does not touch the heap at all.
+// The buffer returned by ws_pool_acquire() is aligned on a 4K page and must
+// be returned to the pool with the same size.
+float *ws_pool_acquire(size_t size);
+void ws_pool_release(float *buf, size_t size);
+// Number of heap allocations made by the pool since the start of the program
+size_t ws_pool_heap_allocs();
 };
 
 }
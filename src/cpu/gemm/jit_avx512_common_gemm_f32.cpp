@@ -1726,7 +1726,8 @@ typedef void (*ker)(long long int, long long int, long long int, float *,
 void jit_avx512_common_gemm_f32::sgemm_nocopy_driver(const char *transa,
         const char *transb, int m, int n, int k, const float *alpha,
         const float *a, int lda, const float *b, int ldb, const float *beta,
-        float *c, int ldc, const float *bias, float *ws)
+        float *c, int ldc, const float *bias, float *ws,
+        const sgemm_post_ops_t *post_ops, int m_off, int n_off)
 {
     bool isTransA = (*transa == 'T' || *transa == 't');
     bool isTransB = (*transb == 'T' || *transb == 't');
@@ -1749,6 +1750,13 @@ void jit_avx512_common_gemm_f32::sgemm_nocopy_driver(const char *transa,
                 for (i = 0; i < m; i++)
                     c[i + j * ldc] *= beta[0];
         }
+        if (bias != NULL) {
+            for (j = 0; j < n; j++)
+                for (i = 0; i < m; i++)
+                    c[i + j * ldc] += bias[i];
+        }
+        if (post_ops != NULL)
+            post_ops->apply(m, n, c, ldc, m_off, n_off);
 
         return;
     }
@@ -1828,6 +1836,11 @@ void jit_avx512_common_gemm_f32::sgemm_nocopy_driver(const char *transa,
                             (long long int)lda, curB, (long long int)ldb, beta,
                             curC, (long long int)ldc, curBias, ws);
                 }
+
+                // Last K-block: C block is final and still hot in cache
+                if (post_ops != NULL && Bk + sizeK >= k)
+                    post_ops->apply(sizeM, sizeN, curC, ldc, m_off + Bm,
+                            n_off + Bn);
             }
         }
     }
@@ -1837,7 +1850,8 @@ void jit_avx512_common_gemm_f32::sgemm_nocopy_driver(const char *transa,
 void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
         const int *p_m, const int *p_n, const int *p_k, const float *p_alpha,
         const float *A, const int *p_lda, const float *B, const int *p_ldb,
-        const float *p_beta, float *C, const int *p_ldc, const float *bias)
+        const float *p_beta, float *C, const int *p_ldc, const float *bias,
+        const sgemm_post_ops_t *post_ops)
 {
     if (beta_ == 0. || beta_ == 1.)
         assert(*p_beta == beta_);
@@ -1860,7 +1874,10 @@ void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
     // Determine threading partitioning
     gemm_utils::calc_nthr_nocopy_avx512_common(
             m, n, k, nthr, &nthr_m, &nthr_n, &nthr_k, &MB, &NB, &KB);
-    assert(utils::implication(!mkldnn_thr_syncable(), nthr_k == 1));
+
+    // Without barriers the partial results along K are summed up after the
+    // parallel section instead of by the threads that computed them
+    const bool sum_in_section = nthr_k > 1 && mkldnn_thr_syncable();
 
     // May not happen, but just in case
     if (nthr < nthr_m * nthr_n * nthr_k)
@@ -1873,20 +1890,22 @@ void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
 
     float *c_buffers = NULL;
     float *ws_buffers = NULL;
+    const size_t c_buffers_size
+            = (size_t)nthr_m * nthr_n * (nthr_k - 1) * MB * NB * sizeof(float);
 
     if (nthr_k > 1) {
-        for (int i = 0; i < nthr; i++)
-            ompstatus[i * CACHE_LINE_SIZE] = 0;
+        if (sum_in_section)
+            for (int i = 0; i < nthr; i++)
+                ompstatus[i * CACHE_LINE_SIZE] = 0;
 
-        c_buffers = (float *)malloc(nthr_m * nthr_n * (nthr_k - 1) * MB * NB
-                * sizeof(float), PAGE_4K);
+        c_buffers = gemm_utils::ws_pool_acquire(c_buffers_size);
     }
 
     const size_t ws_elems_per_thr = k * 48 + 64;
     const size_t ws_size_per_thr
             = utils::rnd_up(ws_elems_per_thr * sizeof(float), PAGE_4K);
     if (k > STACK_K_CAPACITY) {
-        ws_buffers = (float *)malloc(nthr * ws_size_per_thr, PAGE_4K);
+        ws_buffers = gemm_utils::ws_pool_acquire(nthr * ws_size_per_thr);
     }
 
     parallel(nthr, [&](const int ithr, const int nthr) {
@@ -1960,14 +1979,17 @@ void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
                     myBias = NULL;
                 }
 
+                // Post-ops are applied here unless C is partitioned along K,
+                // in which case they are applied after the reduction below
                 sgemm_nocopy_driver(transa, transb, myM, myN, myK, p_alpha, myA,
-                        lda, myB, ldb, &myBeta, myC, ld, myBias, ws);
+                        lda, myB, ldb, &myBeta, myC, ld, myBias, ws,
+                        nthr_k == 1 ? post_ops : NULL, m_from, n_from);
 
-                if (nthr_k > 1)
+                if (sum_in_section)
                     ompstatus[(ibase + ithr_k) * CACHE_LINE_SIZE] = 1;
             }
 
-            if (nthr_k > 1) {
+            if (sum_in_section) {
 
                 // sum matrices partitioned along K dimension
                 int n1, n2;
@@ -2000,13 +2022,22 @@ void jit_avx512_common_gemm_f32::sgemm(const char *transa, const char *transb,
                                 &C[m_from + (n_from + n1) * ldc], ldc);
                     }
                 }
+
+                if (post_ops != NULL && myM > 0 && n2 > 0)
+                    post_ops->apply(myM, n2, &C[m_from + (n_from + n1) * ldc],
+                            ldc, m_from, n_from + n1);
             }
         }
     });
 
+    if (nthr_k > 1 && !sum_in_section)
+        gemm_utils::sum_k_partitions(m, n, nthr_m, nthr_n, nthr_k, MB, NB,
+                c_buffers, C, ldc, post_ops);
+
     if (nthr_k > 1)
-        free(c_buffers);
-    free(ws_buffers);
+        gemm_utils::ws_pool_release(c_buffers, c_buffers_size);
+    if (k > STACK_K_CAPACITY)
+        gemm_utils::ws_pool_release(ws_buffers, nthr * ws_size_per_thr);
 }
 
 jit_avx512_common_gemm_f32::jit_avx512_common_gemm_f32(
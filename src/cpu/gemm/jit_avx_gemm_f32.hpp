@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "../jit_generator.hpp"
+#include "gemm.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -29,7 +30,8 @@ public:
     void sgemm(const char *transa, const char *transb, const int *M,
             const int *N, const int *K, const float *alpha, const float *A,
             const int *lda, const float *B, const int *ldb, const float *beta,
-            float *C, const int *ldc, const float *bias = NULL);
+            float *C, const int *ldc, const float *bias = NULL,
+            const sgemm_post_ops_t *post_ops = NULL);
 
     jit_avx_gemm_f32(
             char transa, char transb, float beta, bool hasBias = false);
@@ -42,7 +44,9 @@ private:
     void sgemm_nocopy_driver(const char *transa, const char *transb, int m,
             int n, int k, const float *alpha, const float *a, int lda,
             const float *b, int ldb, const float *beta, float *c, int ldc,
-            const float *bias, float *ws);
+            const float *bias, float *ws,
+            const sgemm_post_ops_t *post_ops = NULL, int m_off = 0,
+            int n_off = 0);
 
     char transa_, transb_;
     float beta_;
@@ -173,7 +173,6 @@ void ref_gemm(const char *transa_, const char *transb_, const int *M_,
     // thread balancing over M, N, K & size of blocking dimensions
     gemm_utils::calc_nthr_nocopy_avx(
             M, N, K, max_nthr, &nthr_m, &nthr_n, &nthr_k, &MB, &NB, &KB);
-    assert(utils::implication(!mkldnn_thr_syncable(), nthr_k == 1));
 
     float *c_buffers = nullptr, *ws_buffers = nullptr;
     if (nthr_k > 1) {
@@ -185,6 +184,10 @@ void ref_gemm(const char *transa_, const char *transb_, const int *M_,
         }
     }
 
+    // Without barriers the partial results along K are summed up after the
+    // parallel section instead of by the threads that computed them
+    const bool sum_in_section = nthr_k > 1 && mkldnn_thr_syncable();
+
     bool do_copy = (NB / unroll_n > 3);
     const int nthr_mn = nthr_m * nthr_n;
     const int nthr = nthr_mn * nthr_k;
@@ -261,8 +264,7 @@ void ref_gemm(const char *transa_, const char *transb_, const int *M_,
             }
         }
 
-        if (nthr_k > 1) {
-            assert(mkldnn_thr_syncable());
+        if (sum_in_section) {
             mkldnn_thr_barrier();
 
             // sum matrices partitioned along K dimension
@@ -277,6 +279,10 @@ void ref_gemm(const char *transa_, const char *transb_, const int *M_,
         }
     });
 
+    if (nthr_k > 1 && !sum_in_section)
+        gemm_utils::sum_k_partitions(M, N, nthr_m, nthr_n, nthr_k, MB, NB,
+                c_buffers, C, ldc, nullptr);
+
     if (bias) {
         parallel_nd(N, M, [&](int i, int j) {
             C[i*ldc + j] += bias[j];
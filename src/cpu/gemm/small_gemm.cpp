@@ -0,0 +1,332 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+#include "utils.hpp"
+
+#include "../jit_generator.hpp"
+
+#include "gemm.hpp"
+
+#define GET_OFF(field) offsetof(small_sgemm_call_s, field)
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+/* Small sgemm: for tiny matrices (M, N, K < 64) the blocking, the copies into
+ * the thread workspaces and the parallel region of the jit drivers cost more
+ * than the multiplication itself. Here a kernel is generated per shape and
+ * leading dimensions: the whole M fits into one column of accumulators, N is
+ * unrolled into register blocks and A, B and C are addressed with immediate
+ * offsets, so nothing is copied. The kernels are kept in a process-wide
+ * cache. */
+namespace {
+
+constexpr int small_max_dim = 64;
+constexpr int small_max_kernels = 1024;
+
+struct small_sgemm_call_s {
+    const float *a;
+    const float *b;
+    float *c;
+    float alpha;
+    float beta;
+};
+
+struct small_sgemm_key_t {
+    int m, n, k, lda, ldb, ldc;
+    bool trans_b, beta0;
+
+    bool operator<(const small_sgemm_key_t &rhs) const {
+        return std::tie(m, n, k, lda, ldb, ldc, trans_b, beta0)
+            < std::tie(rhs.m, rhs.n, rhs.k, rhs.lda, rhs.ldb, rhs.ldc,
+                    rhs.trans_b, rhs.beta0);
+    }
+};
+
+template <cpu_isa_t isa>
+struct jit_small_sgemm_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_small_sgemm_kernel_t)
+
+    jit_small_sgemm_kernel_t(const small_sgemm_key_t &key)
+        : jit_generator(nullptr, 64 * 1024), key_(key) {
+        generate();
+        ker_ = (decltype(ker_))this->getCode();
+    }
+
+    void operator()(const small_sgemm_call_s *p) const { ker_(p); }
+
+private:
+    using Vmm = typename utils::conditional<isa == avx512_common,
+            Zmm, Ymm>::type;
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr int n_vregs = cpu_isa_traits<isa>::n_vregs;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_a = r8;
+    Reg64 reg_b = r9;
+    Reg64 reg_c = r10;
+    Reg64 reg_k = r11;
+    Reg64 aux_a = r12;
+    Reg64 aux_b = r13;
+    Reg64 reg_tmp = rax;
+
+    Vmm vmm_b = Vmm(n_vregs - 1);
+    Vmm vmm_beta = Vmm(n_vregs - 2);
+    Vmm vmm_tmp = Vmm(n_vregs - 3);
+    Vmm vmm_mask = Vmm(n_vregs - 4);
+    Opmask k_tail = Opmask(1);
+
+    Label l_table;
+
+    void (*ker_)(const small_sgemm_call_s *);
+    small_sgemm_key_t key_;
+    int nv_m, m_tail;
+    bool a_in_regs;
+
+    Vmm vmm_acc(int iv, int j) { return Vmm(iv + j * nv_m); }
+    Vmm vmm_a(int iv) { return Vmm(n_vregs - 5 - iv); }
+
+    bool is_tail(int iv) { return m_tail && iv == nv_m - 1; }
+
+    void fma_mem(Vmm acc, Vmm v, const Address &addr, bool tail) {
+        if (!tail) {
+            vfmadd231ps(acc, v, addr);
+        } else if (isa == avx512_common) {
+            vfmadd231ps(acc | k_tail, v, addr);
+        } else {
+            vmaskmovps(vmm_tmp, vmm_mask, addr);
+            vfmadd231ps(acc, v, vmm_tmp);
+        }
+    }
+
+    void load(Vmm v, const Address &addr, bool tail) {
+        if (!tail)
+            vmovups(v, addr);
+        else if (isa == avx512_common)
+            vmovups(v | k_tail | T_z, addr);
+        else
+            vmaskmovps(v, vmm_mask, addr);
+    }
+
+    void store(const Address &addr, Vmm acc, bool tail) {
+        if (!tail)
+            vmovups(addr, acc);
+        else if (isa == avx512_common)
+            vmovups(addr | k_tail, acc);
+        else
+            vmaskmovps(addr, vmm_mask, acc);
+    }
+
+    void compute_block(int j0, int nr) {
+        const int sz = sizeof(float);
+
+        for (int j = 0; j < nr; j++)
+            for (int iv = 0; iv < nv_m; iv++)
+                uni_vpxor(vmm_acc(iv, j), vmm_acc(iv, j), vmm_acc(iv, j));
+
+        if (key_.k > 0) {
+            Label l_k;
+            mov(aux_a, reg_a);
+            mov(aux_b, reg_b);
+            mov(reg_k, key_.k);
+            L(l_k);
+            if (a_in_regs) {
+                for (int iv = 0; iv < nv_m; iv++)
+                    load(vmm_a(iv), ptr[aux_a + iv * simd_w * sz],
+                            is_tail(iv));
+            }
+            for (int j = 0; j < nr; j++) {
+                const int b_off = key_.trans_b
+                    ? (j0 + j) * sz : (j0 + j) * key_.ldb * sz;
+                vbroadcastss(vmm_b, ptr[aux_b + b_off]);
+                for (int iv = 0; iv < nv_m; iv++) {
+                    if (a_in_regs)
+                        vfmadd231ps(vmm_acc(iv, j), vmm_a(iv), vmm_b);
+                    else
+                        fma_mem(vmm_acc(iv, j), vmm_b,
+                                ptr[aux_a + iv * simd_w * sz], is_tail(iv));
+                }
+            }
+            add(aux_a, key_.lda * sz);
+            add(aux_b, key_.trans_b ? key_.ldb * sz : sz);
+            dec(reg_k);
+            jnz(l_k, T_NEAR);
+        }
+
+        /* alpha reuses the register of the broadcast B element */
+        vbroadcastss(vmm_b, ptr[reg_param + GET_OFF(alpha)]);
+        for (int j = 0; j < nr; j++) {
+            for (int iv = 0; iv < nv_m; iv++) {
+                Vmm acc = vmm_acc(iv, j);
+                auto c_addr = ptr[reg_c
+                    + ((j0 + j) * key_.ldc + iv * simd_w) * sz];
+                vmulps(acc, acc, vmm_b);
+                if (!key_.beta0)
+                    fma_mem(acc, vmm_beta, c_addr, is_tail(iv));
+                store(c_addr, acc, is_tail(iv));
+            }
+        }
+    }
+
+    void generate() {
+        nv_m = div_up(key_.m, simd_w);
+        m_tail = key_.m % simd_w;
+        /* keep the column of A in registers unless the accumulators
+         * would not fit (large M on avx2), then read it from memory */
+        a_in_regs = (n_vregs - 4 - nv_m) / nv_m > 0;
+        const int nr_max = a_in_regs
+            ? (n_vregs - 4 - nv_m) / nv_m : (n_vregs - 4) / nv_m;
+
+        preamble();
+
+        mov(reg_a, ptr[reg_param + GET_OFF(a)]);
+        mov(reg_b, ptr[reg_param + GET_OFF(b)]);
+        mov(reg_c, ptr[reg_param + GET_OFF(c)]);
+        if (!key_.beta0)
+            vbroadcastss(vmm_beta, ptr[reg_param + GET_OFF(beta)]);
+
+        if (m_tail) {
+            if (isa == avx512_common) {
+                mov(reg_tmp.cvt32(), (1 << m_tail) - 1);
+                kmovw(k_tail, reg_tmp.cvt32());
+            } else {
+                mov(reg_tmp, l_table);
+                vmovups(vmm_mask,
+                        ptr[reg_tmp + (simd_w - m_tail) * sizeof(float)]);
+            }
+        }
+
+        for (int j0 = 0; j0 < key_.n; j0 += nr_max)
+            compute_block(j0, nstl::min(nr_max, key_.n - j0));
+
+        postamble();
+
+        if (m_tail && isa != avx512_common) {
+            align(64);
+            L(l_table);
+            for (int i = 0; i < simd_w; i++)
+                dd(0xffffffff);
+            for (int i = 0; i < simd_w; i++)
+                dd(0);
+        }
+    }
+};
+
+template <cpu_isa_t isa>
+const jit_small_sgemm_kernel_t<isa> *get_kernel(const small_sgemm_key_t &key) {
+    static std::mutex mtx;
+    static std::map<small_sgemm_key_t,
+        const jit_small_sgemm_kernel_t<isa> *> kernels;
+
+    std::lock_guard<std::mutex> guard(mtx);
+    auto it = kernels.find(key);
+    if (it != kernels.end())
+        return it->second;
+    if (kernels.size() >= small_max_kernels)
+        return nullptr;
+
+    auto ker = new jit_small_sgemm_kernel_t<isa>(key);
+    kernels[key] = ker;
+    return ker;
+}
+
+template <cpu_isa_t isa>
+mkldnn_status_t small_sgemm_isa(const small_sgemm_key_t &key,
+        const small_sgemm_call_s &p) {
+    auto ker = get_kernel<isa>(key);
+    if (ker == nullptr)
+        return mkldnn_unimplemented;
+    (*ker)(&p);
+    return mkldnn_success;
+}
+
+}
+
+mkldnn_status_t small_sgemm(const char *transa, const char *transb,
+        const int *M, const int *N, const int *K, const float *alpha,
+        const float *A, const int *lda, const float *B, const int *ldb,
+        const float *beta, float *C, const int *ldc,
+        const sgemm_post_ops_t *post_ops) {
+    const int m = *M, n = *N, k = *K;
+    if (nstl::max(m, nstl::max(n, k)) >= small_max_dim
+            || m <= 0 || n <= 0 || k < 0)
+        return mkldnn_unimplemented;
+    if (!mayiuse(avx2))
+        return mkldnn_unimplemented;
+
+    /* inside a parallel region the drivers run single-threaded anyway;
+     * outside of it keep threading for the larger of the small shapes */
+    const int small_work = 32 * 32 * 32;
+    if (!mkldnn_in_parallel() && mkldnn_get_max_threads() > 1
+            && m * n * k > small_work)
+        return mkldnn_unimplemented;
+
+    /* offsets are encoded as 32-bit displacements */
+    const int max_ld = nstl::numeric_limits<int>::max()
+        / (small_max_dim * (int)sizeof(float));
+    if (nstl::max(*lda, nstl::max(*ldb, *ldc)) >= max_ld)
+        return mkldnn_unimplemented;
+
+    /* the kernels load columns of A; a transposed A would have to be
+     * copied first, which the jit drivers already do better */
+    if (one_of(*transa, 'T', 't'))
+        return mkldnn_unimplemented;
+    const bool isTransB = one_of(*transb, 'T', 't');
+
+    small_sgemm_call_s p;
+    p.a = A;
+    p.b = B;
+    p.c = C;
+    p.alpha = *alpha;
+    p.beta = *beta;
+
+    small_sgemm_key_t key;
+    key.m = m;
+    key.n = n;
+    key.k = k;
+    key.lda = *lda;
+    key.ldb = *ldb;
+    key.ldc = *ldc;
+    key.trans_b = isTransB;
+    key.beta0 = *beta == 0.f;
+
+    mkldnn_status_t st = mayiuse(avx512_common)
+        ? small_sgemm_isa<avx512_common>(key, p)
+        : small_sgemm_isa<avx2>(key, p);
+    if (st != mkldnn_success)
+        return st;
+
+    if (post_ops)
+        post_ops->apply(m, n, C, *ldc, 0, 0);
+
+    return mkldnn_success;
+}
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -47,7 +47,6 @@ void _gemm_convolution_fwd_t<with_relu>::execute_forward() {
     const int K = jcp.ic * jcp.ks;
     const int N = jcp.oc;
     const int m = jcp.os;
-    const int LDA = jcp.im2col_sz ? m : M;
 
     const auto &post_ops = conf_.attr()->post_ops_;
 
@@ -63,19 +62,32 @@ void _gemm_convolution_fwd_t<with_relu>::execute_forward() {
     }
     const bool do_relu = jcp.with_relu || entry_idx >= 0;
 
-    data_t *col = jcp.im2col_sz ? (data_t *)this->scratchpad_->get() : nullptr;
+    sgemm_post_ops_t gemm_post_ops;
+    if (jcp.with_bias)
+        gemm_post_ops.bias_kind = sgemm_post_ops_t::bias_per_col;
+    gemm_post_ops.with_relu = do_relu;
+    gemm_post_ops.relu_nslope = nslope;
 
-    parallel_nd(jcp.im2col_sz * jcp.nthr,
-            [&](ptrdiff_t i) { col[i] = (data_t)0; });
+    data_t *col = jcp.im2col_sz ? (data_t *)this->scratchpad_->get() : nullptr;
 
     const size_t work_amount = jcp.ngroups * jcp.mb * jcp.od;
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
         data_t *_col = col + (ptrdiff_t)ithr * jcp.im2col_sz;
 
+        /* With fewer images x groups than threads the threads are split into
+         * teams and each team shares the gemm of its work items. With im2col
+         * the team splits the output channels, so that each thread fills its
+         * own copy of the whole column buffer and no barrier is needed. */
+        const int nteams = (int)nstl::min((size_t)nthr, work_amount);
+        const int team_size = nthr / nteams;
+        const int iteam = ithr / team_size, ithr_team = ithr % team_size;
+        if (iteam >= nteams)
+            return;
+
         int g{0}, n{0}, od{0};
         size_t start = 0, end = 0;
 
-        balance211(work_amount, nthr, ithr, start, end);
+        balance211(work_amount, nteams, iteam, start, end);
         nd_iterator_init(start, g, jcp.ngroups, n, jcp.mb, od, jcp.od);
 
         for (size_t iwork = start; iwork < end; ++iwork) {
@@ -83,29 +95,24 @@ void _gemm_convolution_fwd_t<with_relu>::execute_forward() {
             const data_t *_weights = weights + g * weights_g_size;
             data_t *_dst = dst + (n * jcp.ngroups + g) * dst_step;
 
-            if (jcp.im2col_sz) {
-                if (jcp.id == 1)
-                    jit_gemm_convolution_utils::im2col(jcp, _src, _col);
-                else
-                    jit_gemm_convolution_utils::im2col_3d(jcp, _src, _col, od);
-            }
-
-            const data_t one = 1.0;
-            extended_sgemm("N", "N", &m, &N, &K, &one,
-                    jcp.im2col_sz ? _col : _src + od * m, &LDA, _weights, &K,
-                    &this->beta_, _dst + od * m, &M);
-
-            if (jcp.with_bias || do_relu) {
-                data_t *d = _dst + od * m, b = 0.0;
-                for (int oc = 0; oc < jcp.oc; ++oc) {
-                    if(jcp.with_bias) b = bias[g * jcp.oc + oc];
-                    for (int oS = 0; oS < m; ++oS) {
-                        if (jcp.with_bias) d[oS] += b;
-                        if (do_relu && d[oS] < 0)
-                            d[oS] *= nslope;
-                    }
-                    d += M;
-                }
+            sgemm_post_ops_t g_post_ops = gemm_post_ops;
+            if (jcp.with_bias)
+                g_post_ops.bias = bias + g * jcp.oc;
+
+            for (int ss = 0; ss < m; ss += jcp.os_block) {
+                const int sb = nstl::min(m - ss, jcp.os_block);
+                if (jcp.im2col_sz)
+                    jit_gemm_convolution_utils::im2col(jcp, _src, _col, od,
+                            ss, sb);
+
+                const data_t one = 1.0;
+                const int LDA = jcp.im2col_sz ? sb : M;
+                sgemm_team(ithr_team, team_size, jcp.im2col_sz
+                        ? sgemm_partition_n : sgemm_partition_auto,
+                        "N", "N", &sb, &N, &K, &one,
+                        jcp.im2col_sz ? _col : _src + od * m + ss, &LDA,
+                        _weights, &K, &this->beta_, _dst + od * m + ss, &M,
+                        g_post_ops);
             }
             nd_iterator_step(g, jcp.ngroups, n, jcp.mb, od, jcp.od);
         }
@@ -127,12 +134,12 @@ void gemm_convolution_bwd_data_t::execute_backward_data() {
     const int m = jcp.os;
     const int K = jcp.oc;
     const int N = jcp.ic * jcp.ks;
-    const int LDC = jcp.im2col_sz ? m : M;
     data_t *col = jcp.im2col_sz ? (data_t *)this->scratchpad_->get() : nullptr;
 
     const size_t work_amount = (size_t)jcp.ngroups * jcp.mb;
 
-    if (jcp.id > 1) {
+    /* the columns of the tiles are accumulated to diff_src */
+    if (jcp.im2col_sz) {
         const ptrdiff_t diff_src_sz = (ptrdiff_t)(work_amount * src_step);
         parallel_nd(diff_src_sz, [&](ptrdiff_t i) { diff_src[i] = (data_t)0; });
     }
@@ -148,23 +155,21 @@ void gemm_convolution_bwd_data_t::execute_backward_data() {
 
             data_t *_diff_src = diff_src + (n * jcp.ngroups + g)*src_step;
             const data_t *_weights = weights + g * weights_g_size;
-            for (int od = 0; od < jcp.od; ++od) {
+            for (int od = 0; od < jcp.od; ++od)
+            for (int ss = 0; ss < m; ss += jcp.os_block) {
+                const int sb = nstl::min(m - ss, jcp.os_block);
                 const data_t *_diff_dst = diff_dst + (n * jcp.ngroups + g)
-                    *dst_step + od * m;
+                    *dst_step + od * m + ss;
 
                 const data_t zero = 0.0, one = 1.0;
-                extended_sgemm("N", "T", &m, &N, &K, &one, _diff_dst, &M,
+                const int LDC = jcp.im2col_sz ? sb : M;
+                extended_sgemm("N", "T", &sb, &N, &K, &one, _diff_dst, &M,
                     _weights, &N, &zero,
-                    jcp.im2col_sz ? _col:_diff_src + od * m, &LDC);
-
-                if (jcp.im2col_sz) {
-                    if (jcp.id == 1)
-                        jit_gemm_convolution_utils::col2im(jcp, _col,
-                            _diff_src);
-                    else
-                        jit_gemm_convolution_utils::col2im_3d(jcp, _col,
-                            _diff_src, od);
-                }
+                    jcp.im2col_sz ? _col:_diff_src + od * m + ss, &LDC);
+
+                if (jcp.im2col_sz)
+                    jit_gemm_convolution_utils::col2im(jcp, _col, _diff_src,
+                        od, ss, sb);
             }
             nd_iterator_step(g, jcp.ngroups, n, jcp.mb);
         }
@@ -186,7 +191,6 @@ void gemm_convolution_bwd_weights_t::execute_backward_weights() {
     const int k = jcp.os;
     const int N = jcp.oc;
     const int M = jcp.ic * jcp.ks;
-    const int LDA = jcp.im2col_sz ? k : K;
 
     data_t *col = nullptr, *wei_reduction = nullptr;
     ptrdiff_t wei_offset = 0;
@@ -197,14 +201,15 @@ void gemm_convolution_bwd_weights_t::execute_backward_weights() {
     if (jcp.need_wei_reduction)
         wei_reduction = (data_t *)this->scratchpad_->get() + wei_offset;
 
-    parallel_nd(jcp.im2col_sz * jcp.nthr,
-            [&](ptrdiff_t i) { col[i] = (data_t)0; });
+    /* without barriers the partial weights of the minibatch threads are
+     * reduced in a parallel section of their own */
+    const bool reduce_in_section = mkldnn_thr_syncable();
+    const int mb_for_balance = jcp.need_wei_reduction ? jcp.mb : 1;
 
     parallel(jcp.nthr, [&](const int ithr, const int nthr) {
         int ithr_g, nthr_g, ithr_mb, nthr_mb;
         size_t g_start{0}, g_end{0}, mb_start{0}, mb_end{0};
 
-        const int mb_for_balance = jcp.need_wei_reduction ? jcp.mb : 1;
         jit_gemm_convolution_utils::bwd_weights_balance(ithr, nthr, jcp.ngroups,
                 mb_for_balance, ithr_g, nthr_g, ithr_mb, nthr_mb);
 
@@ -228,38 +233,57 @@ void gemm_convolution_bwd_weights_t::execute_backward_weights() {
                         ? weights_reduce : (diff_weights + g * weights_g_size);
                 for (size_t mb = mb_start; mb < mb_end; ++mb) {
                     const data_t *_src = src + (mb*jcp.ngroups+g)*src_step;
-                    for (int od = 0; od < jcp.od; ++od) {
+                    for (int od = 0; od < jcp.od; ++od)
+                    for (int ss = 0; ss < k; ss += jcp.os_block) {
+                    const int sb = nstl::min(k - ss, jcp.os_block);
                     const data_t *_diff_dst = diff_dst
-                            + (mb*jcp.ngroups+g)*dst_step + od * k;
-
-                    if (jcp.im2col_sz) {
-                        if (jcp.id == 1)
-                            jit_gemm_convolution_utils::im2col(jcp, _src, _col);
-                        else
-                            jit_gemm_convolution_utils::im2col_3d(jcp, _src,
-                                _col, od);
-                    }
+                            + (mb*jcp.ngroups+g)*dst_step + od * k + ss;
+
+                    if (jcp.im2col_sz)
+                        jit_gemm_convolution_utils::im2col(jcp, _src, _col,
+                            od, ss, sb);
 
                     const data_t zero = 0.0, one = 1.0;
+                    const int LDA = jcp.im2col_sz ? sb : K;
                     extended_sgemm(
-                        "T", "N", &M, &N, &k, &one,
-                        jcp.im2col_sz ? _col : _src + od * k,
+                        "T", "N", &M, &N, &sb, &one,
+                        jcp.im2col_sz ? _col : _src + od * k + ss,
                         &LDA, _diff_dst, &K,
-                        mb == mb_start && od == 0 ? &zero : &one,
+                        mb == mb_start && od == 0 && ss == 0 ? &zero : &one,
                         _diff_weights, &M);
                     }
                 }
             }
-            if (need_reduction) {
+            if (need_reduction && reduce_in_section) {
                 mkldnn_thr_barrier();
                 data_t *weights_base = diff_weights + g_start * weights_g_size;
                 jit_gemm_convolution_utils::bwd_weights_reduction_par(
                     ithr_mb, nthr_mb, jcp, weights_reduce_base, weights_base);
             }
         } else
-            if (need_reduction) { mkldnn_thr_barrier(); }
+            if (need_reduction && reduce_in_section) { mkldnn_thr_barrier(); }
     });
 
+    if (jcp.need_wei_reduction && !reduce_in_section) {
+        parallel(jcp.nthr, [&](const int ithr, const int nthr) {
+            int ithr_g, nthr_g, ithr_mb, nthr_mb;
+            jit_gemm_convolution_utils::bwd_weights_balance(ithr, nthr,
+                    jcp.ngroups, mb_for_balance, ithr_g, nthr_g, ithr_mb,
+                    nthr_mb);
+            if (ithr_g == -1 || ithr_mb == -1 || nthr_mb == 1) return;
+
+            size_t g_start{0}, g_end{0};
+            balance211((size_t)jcp.ngroups, nthr_g, ithr_g, g_start, g_end);
+            if (g_start == g_end) return;
+
+            data_t *weights_reduce_base = wei_reduction
+                    + ithr_g * nthr_mb * weights_g_size;
+            data_t *weights_base = diff_weights + g_start * weights_g_size;
+            jit_gemm_convolution_utils::bwd_weights_reduction_par(
+                ithr_mb, nthr_mb, jcp, weights_reduce_base, weights_base);
+        });
+    }
+
     if (jcp.with_bias) {
         parallel_nd(jcp.ngroups, jcp.oc, [&](int g, int oc) {
             data_t db = 0;
@@ -82,6 +82,14 @@ struct _gemm_convolution_fwd_t: public cpu_primitive_t {
             return ok ? status::success : status::unimplemented;
         }
 
+        virtual size_t scratchpad_size() const override {
+            jit_gemm_conv_conf_t jcp;
+            jit_gemm_convolution_utils::init_conf(jcp, this->cdesc_(),
+                    this->src_pd(), this->weights_pd(0), this->dst_pd(),
+                    mkldnn_get_max_threads());
+            return (size_t)jcp.nthr * jcp.im2col_sz * sizeof(float);
+        }
+
         jit_gemm_conv_conf_t jcp_;
 
     protected:
@@ -212,6 +220,14 @@ struct gemm_convolution_bwd_data_t: public cpu_primitive_t {
             return ok ? status::success : status::unimplemented;
         }
 
+        virtual size_t scratchpad_size() const override {
+            jit_gemm_conv_conf_t jcp;
+            jit_gemm_convolution_utils::init_conf(jcp, *this->desc(),
+                    this->diff_src_pd(), this->weights_pd(0),
+                    this->diff_dst_pd(), mkldnn_get_max_threads());
+            return (size_t)jcp.nthr * jcp.im2col_sz * sizeof(float);
+        }
+
         jit_gemm_conv_conf_t jcp_;
 
     protected:
@@ -317,6 +333,18 @@ struct gemm_convolution_bwd_weights_t: public cpu_primitive_t {
             return ok ? status::success : status::unimplemented;
         }
 
+        virtual size_t scratchpad_size() const override {
+            jit_gemm_conv_conf_t jcp;
+            jit_gemm_convolution_utils::init_conf(jcp, *this->desc(),
+                    this->src_pd(), this->diff_weights_pd(0),
+                    this->diff_dst_pd(), mkldnn_get_max_threads());
+            size_t size = (size_t)jcp.im2col_sz * sizeof(float);
+            if (jcp.need_wei_reduction)
+                size += (size_t)jcp.ngroups
+                    * memory_desc_wrapper(this->diff_weights_pd(0)).size();
+            return (size_t)jcp.nthr * size;
+        }
+
         jit_gemm_conv_conf_t jcp_;
 
     protected:
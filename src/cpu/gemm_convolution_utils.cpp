@@ -22,6 +22,7 @@
 #include "utils.hpp"
 
 #include "gemm_convolution_utils.hpp"
+#include "jit_generator.hpp"
 
 namespace mkldnn {
 namespace impl {
@@ -35,133 +36,56 @@ using namespace data_type;
 
 namespace jit_gemm_convolution_utils {
 
-void im2col_3d(jit_gemm_conv_conf_t &jcp, const float *im, float *col, int od) {
-    const size_t OHW = jcp.oh * jcp.ow;
-    const size_t im_step = jcp.ih * jcp.iw * jcp.id;
-    const size_t col_step = jcp.ks * OHW;
+/* The columns of output pixels ss .. ss + sb of depth slice od, with a leading
+ * dimension of sb: col[ic][kd][kh][kw][sb] */
+void im2col(jit_gemm_conv_conf_t &jcp, const float *im, float *col, int od,
+        int ss, int sb) {
+    const size_t im_step = (size_t)jcp.id * jcp.ih * jcp.iw;
+    const int first_oh = ss / jcp.ow, last_oh = (ss + sb - 1) / jcp.ow;
+    const int first_ow = ss % jcp.ow, last_ow = (ss + sb - 1) % jcp.ow;
+
+    parallel_nd(jcp.ic, jcp.kd, jcp.kh, jcp.kw,
+        [&](int ic, int kd, int kh, int kw) {
+        float *col_ = col
+            + ((((size_t)ic * jcp.kd + kd) * jcp.kh + kh) * jcp.kw + kw) * sb;
+        const int id = od * jcp.stride_d - jcp.f_pad + kd * (1 + jcp.dilate_d);
+        const int iw_off = kw * (1 + jcp.dilate_w) - jcp.l_pad;
+
+        /* ow of the row with iw = ow * stride_w + iw_off in [0, iw) */
+        const int ow_lo = iw_off >= 0 ? 0 : div_up(-iw_off, jcp.stride_w);
+        const int ow_hi = jcp.iw - 1 - iw_off < 0
+            ? 0 : (jcp.iw - 1 - iw_off) / jcp.stride_w + 1;
+
+        for (int oh = first_oh; oh <= last_oh; ++oh) {
+            const int ow_s = oh == first_oh ? first_ow : 0;
+            const int ow_e = oh == last_oh ? last_ow + 1 : jcp.ow;
+            float *c = col_ + oh * jcp.ow - ss;
+
+            const int ih = oh * jcp.stride_h - jcp.t_pad
+                + kh * (1 + jcp.dilate_h);
+            if (id < 0 || id >= jcp.id || ih < 0 || ih >= jcp.ih) {
+                PRAGMA_OMP_SIMD()
+                for (int ow = ow_s; ow < ow_e; ++ow) c[ow] = 0.f;
+                continue;
+            }
 
-    parallel_nd(jcp.ic, [&](int ic) {
-        const float *im_loc = im + ic * im_step;
-        float *col_loc = col + ic * col_step;
-        int id = od * jcp.stride_d - jcp.f_pad;
-        for (int kd = 0; kd < jcp.kd; ++kd) {
-            float *col_ = col_loc + kd * jcp.kh * jcp.kw * OHW;
-            if (id < 0 || id >= jcp.id) {
-                int ih_ = -jcp.t_pad;
-                for (int kh = 0; kh < jcp.kh; ++kh) {
-                    int ih = ih_;
-                    for (int oh = 0; oh < jcp.oh; ++oh) {
-                        if (ih < 0 || ih >= jcp.ih) {
-                            ih += jcp.stride_h;
-                            continue;
-                        }
-                        int iw_ = -jcp.l_pad;
-                        for (int kw = 0; kw < jcp.kw; ++kw) {
-                            int iw = iw_;
-                            for (int ow = 0; ow < jcp.ow; ++ow) {
-                                if (iw < 0 || iw >= jcp.iw) {
-                                    iw += jcp.stride_w;
-                                    continue;
-                                }
-
-                                const size_t col_idx = kw * OHW + oh * jcp.ow
-                                    + ow;
-
-                                col_[col_idx] = 0;
-                                iw += jcp.stride_w;
-                            }
-                            iw_ += (1 + jcp.dilate_w);
-                        }
-                        ih += jcp.stride_h;
-                    }
-                    ih_ += (1 + jcp.dilate_h);
-                    col_ += jcp.kw * OHW;
-                }
+            const float *im_ = im + ic * im_step
+                + ((size_t)id * jcp.ih + ih) * jcp.iw + iw_off;
+            const int lo = nstl::min(ow_e, nstl::max(ow_s, ow_lo));
+            const int hi = nstl::max(lo, nstl::min(ow_e, ow_hi));
+            for (int ow = ow_s; ow < lo; ++ow) c[ow] = 0.f;
+            if (jcp.stride_w == 1) {
+                PRAGMA_OMP_SIMD()
+                for (int ow = lo; ow < hi; ++ow) c[ow] = im_[ow];
             } else {
-                const float *im_ = im_loc + id * jcp.ih * jcp.iw;
-                int ih_ = -jcp.t_pad;
-                for (int kh = 0; kh < jcp.kh; ++kh) {
-                    int ih = ih_;
-                    for (int oh = 0; oh < jcp.oh; ++oh) {
-                        if (ih < 0 || ih >= jcp.ih) {
-                            ih += jcp.stride_h;
-                            continue;
-                        }
-                        int iw_ = -jcp.l_pad;
-                        for (int kw = 0; kw < jcp.kw; ++kw) {
-                            int iw = iw_;
-                            for (int ow = 0; ow < jcp.ow; ++ow) {
-                                if (iw < 0 || iw >= jcp.iw) {
-                                    iw += jcp.stride_w;
-                                    continue;
-                                }
-
-                                const size_t col_idx = kw * OHW + oh * jcp.ow
-                                    + ow;
-                                const size_t im_idx = ih * jcp.iw + iw;
-
-                                col_[col_idx] = im_[im_idx];
-                                iw += jcp.stride_w;
-                            }
-                            iw_ += (1 + jcp.dilate_w);
-                        }
-                        ih += jcp.stride_h;
-                    }
-                    ih_ += (1 + jcp.dilate_h);
-                    col_ += jcp.kw * OHW;
-                }
+                for (int ow = lo; ow < hi; ++ow)
+                    c[ow] = im_[ow * jcp.stride_w];
             }
-            id += (1 + jcp.dilate_d);
+            for (int ow = hi; ow < ow_e; ++ow) c[ow] = 0.f;
         }
     });
 }
 
-void im2col(jit_gemm_conv_conf_t &jcp, const float *im, float *col) {
-    if (jcp.ic == 1) {
-        parallel_nd(jcp.kh, jcp.oh, [&](int kh, int oh) {
-            const int ih = oh * jcp.stride_h - jcp.t_pad + kh * (1 + jcp.dilate_h);
-            if (ih < 0 || ih >= jcp.ih) return;
-
-            for (int kw = 0; kw < jcp.kw; ++kw) {
-            for (int ow = 0; ow < jcp.ow; ++ow) {
-                const int iw = ow * jcp.stride_w - jcp.l_pad + kw * (1 + jcp.dilate_w);
-                if (iw < 0 || iw >= jcp.iw) continue;
-
-                const size_t col_idx = ((kh*jcp.kw + kw)*jcp.oh+oh)*jcp.ow+ow;
-                const size_t im_idx = ih*jcp.iw + iw;
-                col[col_idx] = im[im_idx];
-            }}
-        });
-    } else {
-        const size_t im_step = jcp.ih * jcp.iw;
-        const size_t col_step = jcp.ks * jcp.os;
-
-        parallel_nd(jcp.ic, [&](int ic) {
-            const float *im_ = im + ic * im_step;
-            float *col_ = col + ic * col_step;
-
-            for (int kh = 0; kh < jcp.kh; ++kh) {
-            for (int oh = 0; oh < jcp.oh; ++oh) {
-                const int ih = oh * jcp.stride_h
-                               - jcp.t_pad + kh * (1 + jcp.dilate_h);
-                if (ih < 0 || ih >= jcp.ih) continue;
-
-                for (int kw = 0; kw < jcp.kw; ++kw) {
-                for (int ow = 0; ow < jcp.ow; ++ow) {
-                    const int iw = ow * jcp.stride_w
-                                   - jcp.l_pad + kw * (1 + jcp.dilate_w);
-                    if (iw < 0 || iw >= jcp.iw) continue;
-
-                    const size_t col_idx = ((kh * jcp.kw + kw) * jcp.oh+oh)
-                                           * jcp.ow + ow;
-                    const size_t im_idx = ih*jcp.iw + iw;
-                    col_[col_idx] = im_[im_idx];
-                }}
-            }}
-        });
-    }
-}
-
 /* col[oh][ow][kh][kw][ic] <-- im2col_u8(im[ih][iw][ic]) */
 void im2col_u8(jit_gemm_conv_conf_t &jcp, const uint8_t *im, uint8_t *col) {
     parallel_nd(jcp.oh, jcp.ow, [&](int oh, int ow) {
@@ -242,75 +166,49 @@ void col2im_s32(jit_gemm_conv_conf_t &jcp, const int32_t *col, int32_t *im) {
     });
 }
 
-void col2im_3d(jit_gemm_conv_conf_t &jcp, const float *col, float *im, int od) {
-    parallel_nd(jcp.ic, [&](int ic) {
-        const float *col_ = col + (size_t)ic * jcp.ks * jcp.os;
-        float *im_ic = im + (size_t)ic * jcp.ih * jcp.iw * jcp.id;
+/* Accumulates the columns of output pixels ss .. ss + sb of depth slice od
+ * laid out as by im2col() back to the image */
+void col2im(jit_gemm_conv_conf_t &jcp, const float *col, float *im, int od,
+        int ss, int sb) {
+    const size_t im_step = (size_t)jcp.id * jcp.ih * jcp.iw;
+    const int first_oh = ss / jcp.ow, last_oh = (ss + sb - 1) / jcp.ow;
+    const int first_ow = ss % jcp.ow, last_ow = (ss + sb - 1) % jcp.ow;
 
-        int id = od * jcp.stride_d - jcp.f_pad;
+    parallel_nd(jcp.ic, [&](int ic) {
         for (int kd = 0; kd < jcp.kd; ++kd) {
-            if (id < 0 || id >= jcp.id) {
-                col_ += jcp.kh * jcp.kw * jcp.os;
-                id += (1 + jcp.dilate_d);
-                continue;
-            }
-
-            float *im_ = im_ic + id * jcp.ih * jcp.iw;
+        const int id = od * jcp.stride_d - jcp.f_pad + kd * (1 + jcp.dilate_d);
+        if (id < 0 || id >= jcp.id) continue;
 
-            for (int oh = 0; oh < jcp.oh; ++oh) {
-            for (int kh = 0; kh < jcp.kh; ++kh) {
+        for (int kh = 0; kh < jcp.kh; ++kh) {
+        for (int kw = 0; kw < jcp.kw; ++kw) {
+            const float *col_ = col + ((((size_t)ic * jcp.kd + kd) * jcp.kh
+                        + kh) * jcp.kw + kw) * sb;
+            const int iw_off = kw * (1 + jcp.dilate_w) - jcp.l_pad;
+            const int ow_lo = iw_off >= 0 ? 0 : div_up(-iw_off, jcp.stride_w);
+            const int ow_hi = jcp.iw - 1 - iw_off < 0
+                ? 0 : (jcp.iw - 1 - iw_off) / jcp.stride_w + 1;
+
+            for (int oh = first_oh; oh <= last_oh; ++oh) {
                 const int ih = oh * jcp.stride_h - jcp.t_pad
                     + kh * (1 + jcp.dilate_h);
                 if (ih < 0 || ih >= jcp.ih) continue;
 
-                for (int ow = 0; ow < jcp.ow; ++ow) {
-                for (int kw = 0; kw < jcp.kw; ++kw) {
-                    const int iw = ow * jcp.stride_w - jcp.l_pad
-                        + kw * (1 + jcp.dilate_w);
-                    if (iw < 0 || iw >= jcp.iw) continue;
-
-                    const size_t col_idx = ((kh*jcp.kw + kw)*jcp.oh+oh)*jcp.ow+ow;
-                    const size_t im_idx = ih*jcp.iw + iw;
-                    im_[im_idx] += col_[col_idx];
-                }}
-            }}
-
-            col_ += jcp.kh * jcp.kw * jcp.os;
-            id += (1 + jcp.dilate_d);
-        }
-    });
-}
-
-void col2im(
-    jit_gemm_conv_conf_t &jcp, const float *col, float *im) {
-
-    const size_t col_step = jcp.ks * jcp.os;
-    const size_t im_step = jcp.ih * jcp.iw;
-    const int iS = jcp.ih * jcp.iw;
-
-    parallel_nd(jcp.ic, [&](int ic) {
-        float *im_ = im + ic * im_step;
-        const float *col_ = col + ic * col_step;
-        PRAGMA_OMP_SIMD()
-        for (int is = 0; is < iS; ++is) im_[is] = 0.;
-
-        for (int kh = 0; kh < jcp.kh; ++kh) {
-        for (int oh = 0; oh < jcp.oh; ++oh) {
-            const int ih = oh * jcp.stride_h - jcp.t_pad + kh * (1 + jcp.dilate_h);
-            if (ih < 0 || ih >= jcp.ih) continue;
-
-            for (int kw = 0; kw < jcp.kw; ++kw) {
-            for (int ow = 0; ow < jcp.ow; ++ow) {
-                const int iw = ow * jcp.stride_w - jcp.l_pad + kw * (1 + jcp.dilate_w);
-                if (iw < 0 || iw >= jcp.iw) continue;
-
-                const size_t col_idx = ((kh*jcp.kw + kw)*jcp.oh+oh)*jcp.ow+ow;
-                const size_t im_idx = ih*jcp.iw + iw;
-                im_[im_idx] += col_[col_idx];
-            }
+                const int ow_s = oh == first_oh ? first_ow : 0;
+                const int ow_e = oh == last_oh ? last_ow + 1 : jcp.ow;
+                const int lo = nstl::max(ow_s, ow_lo);
+                const int hi = nstl::min(ow_e, ow_hi);
+                const float *c = col_ + oh * jcp.ow - ss;
+                float *im_ = im + ic * im_step
+                    + ((size_t)id * jcp.ih + ih) * jcp.iw + iw_off;
+                if (jcp.stride_w == 1) {
+                    PRAGMA_OMP_SIMD()
+                    for (int ow = lo; ow < hi; ++ow) im_[ow] += c[ow];
+                } else {
+                    for (int ow = lo; ow < hi; ++ow)
+                        im_[ow * jcp.stride_w] += c[ow];
+                }
             }
-        }
-        }
+        }}}
     });
 }
 
@@ -346,7 +244,7 @@ void init_conf(
     jcp.t_pad = is_1d ? 0 : cd.padding[0][ndims - 4];
     jcp.l_pad = cd.padding[0][ndims - 3];
 
-    jcp.stride_d = is_3d ? 1 : cd.strides[0];
+    jcp.stride_d = is_3d ? cd.strides[0] : 1;
     jcp.stride_h = is_1d ? 1 : cd.strides[ndims - 4];
     jcp.stride_w = cd.strides[ndims - 3];
 
@@ -364,14 +262,32 @@ void init_conf(
     jcp.is = jcp.ih * jcp.iw;
     jcp.os = jcp.oh * jcp.ow;
     jcp.ks = jcp.kh * jcp.kw * jcp.kd;
-    jcp.im2col_sz = !(jcp.oh == jcp.ih && jcp.ow == jcp.iw
-                            && jcp.od == jcp.id && jcp.ks == 1)
-        ? (ptrdiff_t)jcp.ic * jcp.ks * jcp.os
-        : 0;
+    const bool need_im2col = !(jcp.oh == jcp.ih && jcp.ow == jcp.iw
+                            && jcp.od == jcp.id && jcp.ks == 1);
 
     bool do_outer_threading = false;
     bool is_int8_conv = (cd.src_desc.data_type == u8
             && cd.weights_desc.data_type == s8);
+
+    /* f32 columns are built in tiles of output pixels, so that a tile stays
+     * in L2 next to the gemm panels while the gemm goes through it instead
+     * of the columns of a whole image slice going to memory. A tile is not
+     * made shorter than what the gemm needs to run at speed, and is an odd
+     * multiple of 16 pixels: with a power of 2 leading dimension the rows of
+     * the transposed columns in backward by weights fall on the same cache
+     * sets */
+    const bool is_f32 = (jcp.prop_kind == backward_weights
+            ? cd.diff_weights_desc : cd.weights_desc).data_type == f32;
+    jcp.os_block = jcp.os;
+    if (need_im2col && is_f32) {
+        const size_t col_row_size = sizeof(float) * jcp.ic * jcp.ks;
+        const int os_block = (int)(get_cache_size(2) / 2 / col_row_size);
+        jcp.os_block = nstl::min(jcp.os,
+                rnd_dn(nstl::max(os_block, 256), 32) + 16);
+    }
+    jcp.im2col_sz = need_im2col
+        ? (ptrdiff_t)jcp.ic * jcp.ks * jcp.os_block
+        : 0;
     if (is_int8_conv) {
         bool is_depthwise =
                 utils::everyone_is(1, jcp.ic, jcp.oc) && jcp.ngroups != 1;
@@ -388,8 +304,7 @@ void init_conf(
                        && (jcp.mb != 1 || jcp.ngroups > 2);
     }
     jcp.nthr = do_outer_threading ? max_threads : 1;
-    jcp.need_wei_reduction = mkldnn_thr_syncable()
-        ? (jcp.mb != 1 && jcp.nthr != 1) : false;
+    jcp.need_wei_reduction = jcp.mb != 1 && jcp.nthr != 1;
 }
 
 status_t prepare_scratchpad(jit_gemm_conv_conf_t &jcp,
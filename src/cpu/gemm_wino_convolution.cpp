@@ -0,0 +1,651 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "mkldnn_types.h"
+
+#include "c_types_map.hpp"
+#include "gemm_wino_convolution.hpp"
+#include "gemm/gemm.hpp"
+#include "jit_generator.hpp"
+#include "mkldnn_thread.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace mkldnn::impl::status;
+using namespace mkldnn::impl::memory_format;
+using namespace mkldnn::impl::utils;
+
+namespace {
+
+const int simd_w = 8;
+const int max_alpha = 6;
+
+/* F(2x2, 3x3) */
+const float Bt_2x3[4 * 4] = {
+    1.f,  0.f, -1.f,  0.f,
+    0.f,  1.f,  1.f,  0.f,
+    0.f, -1.f,  1.f,  0.f,
+    0.f,  1.f,  0.f, -1.f,
+};
+const float G_2x3[4 * 3] = {
+    1.f,  0.f, 0.f,
+    .5f,  .5f, .5f,
+    .5f, -.5f, .5f,
+    0.f,  0.f, 1.f,
+};
+const float At_2x3[2 * 4] = {
+    1.f, 1.f,  1.f,  0.f,
+    0.f, 1.f, -1.f, -1.f,
+};
+
+/* F(4x4, 3x3), scaled the same way as in the avx512 implementations and in
+ * the wino_fmt weights reorder */
+const float Bt_4x3[6 * 6] = {
+    0.87890625f, 0.f, -2.640625f, 0.f, 1.f, 0.f,
+    0.f, -1.40625f, -2.25f, 0.625f, 1.f, 0.f,
+    0.f, 1.40625f, -2.25f, -0.625f, 1.f, 0.f,
+    0.f, -0.5859375f, -0.390625f, 1.5f, 1.f, 0.f,
+    0.f, 0.5859375f, -0.390625f, -1.5f, 1.f, 0.f,
+    0.f, 0.87890625f, 0.f, -2.640625f, 0.f, 1.f,
+};
+const float G_4x3[6 * 3] = {
+    1.13777777777778f, 0.f, 0.f,
+    -0.688403361344538f, -0.430252100840336f, -0.26890756302521f,
+    -0.688403361344538f, 0.430252100840336f, -0.26890756302521f,
+    0.119514472455649f, 0.179271708683473f, 0.26890756302521f,
+    0.119514472455649f, -0.179271708683473f, 0.26890756302521f,
+    0.f, 0.f, 1.f,
+};
+const float At_4x3[4 * 6] = {
+    1.f, 1.f, 1.f, 1.f, 1.f, 0.f,
+    0.f, 0.625f, -0.625f, 1.5f, -1.5f, 0.f,
+    0.f, 0.390625f, 0.390625f, 2.25f, 2.25f, 0.f,
+    0.f, 0.244140625f, -0.244140625f, 3.375f, -3.375f, 1.f,
+};
+
+/* out[i][j] = sum_{k,q} L[i][k] * in[k][q] * L[j][q] for simd_w independent
+ * lanes, where L is a no x ni matrix (passed as its ni x no transpose if
+ * transposed is set) */
+template <int no, int ni, bool transposed>
+void trans_2d(const float *L, const float *in, float *out) {
+    float tmp[no * ni * simd_w];
+    auto l = [&](int i, int k) {
+        return transposed ? L[k * no + i] : L[i * ni + k];
+    };
+
+    for (int i = 0; i < no; ++i)
+    for (int q = 0; q < ni; ++q) {
+        float *t = &tmp[(i * ni + q) * simd_w];
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; ++v) t[v] = 0.f;
+        for (int k = 0; k < ni; ++k) {
+            const float c = l(i, k);
+            if (c == 0.f) continue;
+            const float *s = &in[(k * ni + q) * simd_w];
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) t[v] += c * s[v];
+        }
+    }
+
+    for (int i = 0; i < no; ++i)
+    for (int j = 0; j < no; ++j) {
+        float *o = &out[(i * no + j) * simd_w];
+        PRAGMA_OMP_SIMD()
+        for (int v = 0; v < simd_w; ++v) o[v] = 0.f;
+        for (int q = 0; q < ni; ++q) {
+            const float c = l(j, q);
+            if (c == 0.f) continue;
+            const float *t = &tmp[(i * ni + q) * simd_w];
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) o[v] += c * t[v];
+        }
+    }
+}
+
+/* the transforms of F(m x m, 3 x 3), dispatched on m so that the loops
+ * above are fully unrolled */
+struct wino_transforms_t {
+    wino_transforms_t(int m): m_(m) {}
+
+    /* B^T d B */
+    void src(const float *in, float *out) const {
+        if (m_ == 2) trans_2d<4, 4, false>(Bt_2x3, in, out);
+        else trans_2d<6, 6, false>(Bt_4x3, in, out);
+    }
+    /* A^T M A */
+    void dst(const float *in, float *out) const {
+        if (m_ == 2) trans_2d<2, 4, false>(At_2x3, in, out);
+        else trans_2d<4, 6, false>(At_4x3, in, out);
+    }
+    /* G g G^T */
+    void wei(const float *in, float *out) const {
+        if (m_ == 2) trans_2d<4, 3, false>(G_2x3, in, out);
+        else trans_2d<6, 3, false>(G_4x3, in, out);
+    }
+    /* A dY A^T */
+    void diff_dst(const float *in, float *out) const {
+        if (m_ == 2) trans_2d<4, 2, true>(At_2x3, in, out);
+        else trans_2d<6, 4, true>(At_4x3, in, out);
+    }
+    /* G^T dU G */
+    void diff_wei(const float *in, float *out) const {
+        if (m_ == 2) trans_2d<3, 4, true>(G_2x3, in, out);
+        else trans_2d<3, 6, true>(G_4x3, in, out);
+    }
+
+private:
+    int m_;
+};
+
+inline void tile_coords(const gemm_wino_conv_conf_t &jcp, int tile,
+        int &n, int &ty, int &tx) {
+    nd_iterator_init(tile, n, jcp.mb, ty, jcp.tiles_h, tx, jcp.tiles_w);
+}
+
+/* V[a][t][:] = (B^T d B)[a] for all the input channel blocks of a tile */
+void src_transform_tile(const gemm_wino_conv_conf_t &jcp,
+        const wino_transforms_t &wt, const float *src, int tile, float *V,
+        int t) {
+    const int alpha = jcp.alpha;
+    const int nb_ic = jcp.ic / simd_w;
+    int n, ty, tx;
+    tile_coords(jcp, tile, n, ty, tx);
+    const int y0 = ty * jcp.m - jcp.t_pad, x0 = tx * jcp.m - jcp.l_pad;
+
+    float d[max_alpha * max_alpha * simd_w], bd[max_alpha * max_alpha * simd_w];
+    for (int icb = 0; icb < nb_ic; ++icb) {
+        const float *s = src + (size_t)(n * nb_ic + icb) * jcp.ih * jcp.iw
+            * simd_w;
+        for (int i = 0; i < alpha; ++i)
+        for (int j = 0; j < alpha; ++j) {
+            const int y = y0 + i, x = x0 + j;
+            float *dd = &d[(i * alpha + j) * simd_w];
+            if (y < 0 || y >= jcp.ih || x < 0 || x >= jcp.iw) {
+                PRAGMA_OMP_SIMD()
+                for (int v = 0; v < simd_w; ++v) dd[v] = 0.f;
+            } else {
+                const float *ss = &s[(y * jcp.iw + x) * simd_w];
+                PRAGMA_OMP_SIMD()
+                for (int v = 0; v < simd_w; ++v) dd[v] = ss[v];
+            }
+        }
+        wt.src(d, bd);
+        for (int a = 0; a < alpha * alpha; ++a) {
+            float *vv = &V[((size_t)a * jcp.tile_block + t) * jcp.ic
+                + icb * simd_w];
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) vv[v] = bd[a * simd_w + v];
+        }
+    }
+}
+
+/* dst = post_ops(A^T M[:][t] A + bias) for all the output channel blocks of
+ * a tile, storing only the pixels inside the output */
+void dst_transform_tile(const gemm_wino_conv_conf_t &jcp,
+        const wino_transforms_t &wt, const float *M, int t, int tile,
+        const float *bias, float *dst) {
+    const int alpha = jcp.alpha, m = jcp.m;
+    const int nb_oc = jcp.oc / simd_w;
+    int n, ty, tx;
+    tile_coords(jcp, tile, n, ty, tx);
+    const int y0 = ty * m, x0 = tx * m;
+    const float nslope = jcp.relu_negative_slope;
+
+    float mm[max_alpha * max_alpha * simd_w], y[max_alpha * max_alpha * simd_w];
+    for (int ocb = 0; ocb < nb_oc; ++ocb) {
+        for (int a = 0; a < alpha * alpha; ++a) {
+            const float *ms = &M[((size_t)a * jcp.tile_block + t) * jcp.oc
+                + ocb * simd_w];
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) mm[a * simd_w + v] = ms[v];
+        }
+        wt.dst(mm, y);
+
+        float *d = dst + (size_t)(n * nb_oc + ocb) * jcp.oh * jcp.ow * simd_w;
+        const float *b = bias ? bias + ocb * simd_w : nullptr;
+        for (int i = 0; i < m && y0 + i < jcp.oh; ++i)
+        for (int j = 0; j < m && x0 + j < jcp.ow; ++j) {
+            float *dd = &d[((y0 + i) * jcp.ow + x0 + j) * simd_w];
+            const float *yy = &y[(i * m + j) * simd_w];
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) {
+                float r = yy[v];
+                if (b) r += b[v];
+                if (jcp.with_sum) r += dd[v];
+                if (jcp.with_relu && r < 0.f) r *= nslope;
+                dd[v] = r;
+            }
+        }
+    }
+}
+
+/* U[a][cin][cout] = (G g G^T)[a]; for backward by data cin and cout are the
+ * output and input channels and the kernel is rotated by 180 degrees */
+void transform_weights(const gemm_wino_conv_conf_t &jcp, const float *wei,
+        float *U, bool bwd_data) {
+    const int alpha = jcp.alpha;
+    const int cin = jcp.ic_without_padding, cout = jcp.oc_without_padding;
+    const wino_transforms_t wt(jcp.m);
+
+    parallel_nd(jcp.ic, jcp.oc / simd_w, [&](int ci, int cob) {
+        float g[3 * 3 * simd_w], u[max_alpha * max_alpha * simd_w];
+        for (int kh = 0; kh < 3; ++kh)
+        for (int kw = 0; kw < 3; ++kw)
+        for (int v = 0; v < simd_w; ++v) {
+            const int co = cob * simd_w + v;
+            float w = 0.f;
+            if (ci < cin && co < cout)
+                w = bwd_data
+                    ? wei[((size_t)ci * cout + co) * 9 + (2 - kh) * 3 + 2 - kw]
+                    : wei[((size_t)co * cin + ci) * 9 + kh * 3 + kw];
+            g[(kh * 3 + kw) * simd_w + v] = w;
+        }
+        wt.wei(g, u);
+        for (int a = 0; a < alpha * alpha; ++a) {
+            float *uu = &U[((size_t)a * jcp.ic + ci) * jcp.oc + cob * simd_w];
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) uu[v] = u[a * simd_w + v];
+        }
+    });
+}
+
+/* The data pass of forward and backward by data: each thread takes whole
+ * blocks of tiles and runs transform -> alpha^2 sgemm -> transform on them
+ * with V and M kept in its own workspace */
+void data_pass(const gemm_wino_conv_conf_t &jcp, const float *src,
+        const float *U, const float *bias, float *dst, float *ws,
+        size_t ws_per_thread) {
+    const wino_transforms_t wt(jcp.m);
+    const int alpha2 = jcp.alpha * jcp.alpha;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        int start{0}, end{0};
+        balance211(jcp.nb_tile_blocks, nthr, ithr, start, end);
+
+        float *V = ws + ithr * ws_per_thread;
+        float *M = V + (size_t)alpha2 * jcp.tile_block * jcp.ic;
+
+        for (int tblk = start; tblk < end; ++tblk) {
+            const int tile_start = tblk * jcp.tile_block;
+            const int nt = nstl::min(jcp.ntiles - tile_start,
+                    jcp.tile_block);
+
+            for (int t = 0; t < nt; ++t)
+                src_transform_tile(jcp, wt, src, tile_start + t, V, t);
+
+            const float one = 1.f, zero = 0.f;
+            for (int a = 0; a < alpha2; ++a)
+                extended_sgemm("N", "N", &jcp.oc, &nt, &jcp.ic, &one,
+                        U + (size_t)a * jcp.ic * jcp.oc, &jcp.oc,
+                        V + (size_t)a * jcp.tile_block * jcp.ic, &jcp.ic,
+                        &zero, M + (size_t)a * jcp.tile_block * jcp.oc,
+                        &jcp.oc);
+
+            for (int t = 0; t < nt; ++t)
+                dst_transform_tile(jcp, wt, M, t, tile_start + t, bias, dst);
+        }
+    });
+}
+
+size_t data_pass_ws_per_thread(const gemm_wino_conv_conf_t &jcp) {
+    return (size_t)jcp.alpha * jcp.alpha * jcp.tile_block
+        * (jcp.ic + jcp.oc);
+}
+
+}
+
+namespace gemm_wino_convolution_utils {
+
+status_t init_conf(gemm_wino_conv_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &dst_d,
+        const primitive_attr_t &attr, bool with_relu,
+        float relu_negative_slope) {
+    const bool bwd_data = cd.prop_kind == prop_kind::backward_data;
+    const bool bwd_weights = cd.prop_kind == prop_kind::backward_weights;
+    const memory_desc_t &wei_md
+        = bwd_weights ? cd.diff_weights_desc : cd.weights_desc;
+
+    bool ok = true
+        && src_d.ndims() == 4
+        && wei_md.ndims == 4 /* no groups */
+        && wei_md.dims[2] == 3 && wei_md.dims[3] == 3
+        && cd.strides[0] == 1 && cd.strides[1] == 1
+        && cd.dilates[0] == 0 && cd.dilates[1] == 0
+        && cd.padding[0][0] <= 2 && cd.padding[0][1] <= 2;
+    if (!ok) return unimplemented;
+
+    /* the data pass reads diff_dst and writes diff_src when going backward
+     * by data */
+    const memory_desc_wrapper &in_d = bwd_data ? dst_d : src_d;
+    const memory_desc_wrapper &out_d = bwd_data ? src_d : dst_d;
+
+    jcp.mb = src_d.dims()[0];
+    jcp.ic_without_padding = in_d.dims()[1];
+    jcp.oc_without_padding = out_d.dims()[1];
+    jcp.ic = rnd_up(jcp.ic_without_padding, simd_w);
+    jcp.oc = rnd_up(jcp.oc_without_padding, simd_w);
+    jcp.ih = in_d.dims()[2];
+    jcp.iw = in_d.dims()[3];
+    jcp.oh = out_d.dims()[2];
+    jcp.ow = out_d.dims()[3];
+    jcp.t_pad = bwd_data ? 2 - cd.padding[0][0] : cd.padding[0][0];
+    jcp.l_pad = bwd_data ? 2 - cd.padding[0][1] : cd.padding[0][1];
+
+    /* F(4x4, 3x3) does 4x fewer multiplications than direct convolution,
+     * but wastes more of it on the border tiles of small images */
+    jcp.m = (jcp.oh >= 8 && jcp.ow >= 8) ? 4 : 2;
+    jcp.alpha = jcp.m + 2;
+
+    jcp.tiles_h = div_up(jcp.oh, jcp.m);
+    jcp.tiles_w = div_up(jcp.ow, jcp.m);
+    jcp.ntiles = jcp.mb * jcp.tiles_h * jcp.tiles_w;
+
+    const int nthr = mkldnn_get_max_threads();
+    if (bwd_weights) {
+        /* blocks of tiles are processed one at a time by all the threads,
+         * so they need to be large enough to feed everybody */
+        jcp.tile_block = nstl::min(jcp.ntiles, nstl::max(64, 16 * nthr));
+    } else {
+        /* keep V and M of a block of tiles within a half of L2 */
+        const size_t tile_size = sizeof(float) * jcp.alpha * jcp.alpha
+            * (jcp.ic + jcp.oc);
+        int tb = (int)(get_cache_size(2, true) / 2 / tile_size);
+        tb = nstl::max(32, nstl::min(256, tb));
+        tb = nstl::min(tb, div_up(jcp.ntiles, nthr));
+        jcp.tile_block = nstl::max(1, tb);
+    }
+    jcp.nb_tile_blocks = div_up(jcp.ntiles, jcp.tile_block);
+
+    const auto &p = attr.post_ops_;
+    jcp.with_bias = !bwd_data && !memory_desc_wrapper(bwd_weights
+            ? cd.diff_bias_desc : cd.bias_desc).is_zero();
+    jcp.with_sum = p.find(primitive_kind::sum) != -1;
+    jcp.with_relu = with_relu;
+    jcp.relu_negative_slope = relu_negative_slope;
+    const int relu_idx = p.find(primitive_kind::eltwise);
+    if (relu_idx != -1) {
+        jcp.with_relu = true;
+        jcp.relu_negative_slope = p.entry_[relu_idx].eltwise.alpha;
+    }
+    jcp.wino_weights = false;
+
+    return success;
+}
+
+void init_wino_weights_md(const gemm_wino_conv_conf_t &jcp,
+        memory_desc_t &wei_md) {
+    /* both layouts reduce to U[a][ic][oc] with a single oc block */
+    wei_md.format = mkldnn_wino_fmt;
+    wei_md.data_type = data_type::f32;
+    mkldnn_wino_desc_t &wd = wei_md.layout_desc.wino_desc;
+    wd.wino_format = jcp.m == 2
+        ? mkldnn_wino_wei_aaOio : mkldnn_wino_wei_OBaaIBOIio;
+    wd.r = 3;
+    wd.alpha = jcp.alpha;
+    wd.ic = jcp.ic;
+    wd.oc = jcp.oc;
+    wd.ic_block = simd_w;
+    wd.oc_block = jcp.oc;
+    wd.ic2_block = 1;
+    wd.oc2_block = 1;
+    wd.size = sizeof(float) * jcp.alpha * jcp.alpha * jcp.ic * jcp.oc;
+}
+
+size_t scratchpad_size(const gemm_wino_conv_conf_t &jcp, prop_kind_t prop) {
+    const size_t wei = (size_t)jcp.alpha * jcp.alpha * jcp.ic * jcp.oc;
+    const size_t ws = data_pass_ws_per_thread(jcp);
+    size_t size = 0;
+    switch (prop) {
+    case prop_kind::backward_weights: size = wei + ws; break;
+    case prop_kind::backward_data:
+        size = wei + ws * mkldnn_get_max_threads(); break;
+    default:
+        size = (jcp.wino_weights ? 0 : wei)
+            + (jcp.with_bias && jcp.oc != jcp.oc_without_padding ? jcp.oc : 0)
+            + ws * mkldnn_get_max_threads();
+    }
+    return sizeof(float) * size;
+}
+
+}
+
+template <bool with_relu>
+_gemm_wino_convolution_fwd_t<with_relu>::_gemm_wino_convolution_fwd_t(
+        const pd_t *pd, const input_vector &inputs,
+        const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
+    , wino_wei_(nullptr), padded_bias_(nullptr) {
+    const auto &jcp = conf_.jcp_;
+
+    if (!jcp.wino_weights)
+        wino_wei_ = (data_t *)malloc(sizeof(data_t) * jcp.alpha * jcp.alpha
+                * jcp.ic * jcp.oc, 64);
+    if (jcp.with_bias && jcp.oc != jcp.oc_without_padding) {
+        padded_bias_ = (data_t *)malloc(sizeof(data_t) * jcp.oc, 64);
+        array_set(padded_bias_, 0.f, jcp.oc);
+    }
+
+    ws_per_thread_ = data_pass_ws_per_thread(jcp);
+    ws_ = (data_t *)malloc(sizeof(data_t) * ws_per_thread_
+            * mkldnn_get_max_threads(), 64);
+}
+
+template <bool with_relu>
+_gemm_wino_convolution_fwd_t<with_relu>::~_gemm_wino_convolution_fwd_t() {
+    free(wino_wei_);
+    free(padded_bias_);
+    free(ws_);
+}
+
+template <bool with_relu>
+void _gemm_wino_convolution_fwd_t<with_relu>::execute_forward() {
+    auto src = reinterpret_cast<const data_t *>(this->input_memory(0));
+    auto weights = reinterpret_cast<const data_t *>(this->input_memory(1));
+    auto bias = reinterpret_cast<const data_t *>(this->input_memory(2));
+    auto dst = reinterpret_cast<data_t *>(this->memory());
+
+    const auto &jcp = conf_.jcp_;
+
+    const data_t *U = weights;
+    if (!jcp.wino_weights) {
+        transform_weights(jcp, weights, wino_wei_, false);
+        U = wino_wei_;
+    }
+
+    if (jcp.with_bias && padded_bias_ != nullptr) {
+        for (int oc = 0; oc < jcp.oc_without_padding; ++oc)
+            padded_bias_[oc] = bias[oc];
+        bias = padded_bias_;
+    }
+
+    data_pass(jcp, src, U, jcp.with_bias ? bias : nullptr, dst, ws_,
+            ws_per_thread_);
+}
+
+template struct _gemm_wino_convolution_fwd_t<true>;
+template struct _gemm_wino_convolution_fwd_t<false>;
+
+gemm_wino_convolution_bwd_data_t::gemm_wino_convolution_bwd_data_t(
+        const pd_t *pd, const input_vector &inputs,
+        const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd) {
+    const auto &jcp = conf_.jcp_;
+
+    wino_wei_ = (data_t *)malloc(sizeof(data_t) * jcp.alpha * jcp.alpha
+            * jcp.ic * jcp.oc, 64);
+    ws_per_thread_ = data_pass_ws_per_thread(jcp);
+    ws_ = (data_t *)malloc(sizeof(data_t) * ws_per_thread_
+            * mkldnn_get_max_threads(), 64);
+}
+
+gemm_wino_convolution_bwd_data_t::~gemm_wino_convolution_bwd_data_t() {
+    free(wino_wei_);
+    free(ws_);
+}
+
+void gemm_wino_convolution_bwd_data_t::execute_backward_data() {
+    auto diff_dst = reinterpret_cast<const data_t *>(this->input_memory(0));
+    auto weights = reinterpret_cast<const data_t *>(this->input_memory(1));
+    auto diff_src = reinterpret_cast<data_t *>(this->memory());
+
+    const auto &jcp = conf_.jcp_;
+
+    transform_weights(jcp, weights, wino_wei_, true);
+    data_pass(jcp, diff_dst, wino_wei_, nullptr, diff_src, ws_,
+            ws_per_thread_);
+}
+
+gemm_wino_convolution_bwd_weights_t::gemm_wino_convolution_bwd_weights_t(
+        const pd_t *pd, const input_vector &inputs,
+        const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd) {
+    const auto &jcp = conf_.jcp_;
+
+    wino_diff_wei_ = (data_t *)malloc(sizeof(data_t) * jcp.alpha * jcp.alpha
+            * jcp.ic * jcp.oc, 64);
+    ws_ = (data_t *)malloc(sizeof(data_t) * data_pass_ws_per_thread(jcp), 64);
+}
+
+gemm_wino_convolution_bwd_weights_t::~gemm_wino_convolution_bwd_weights_t() {
+    free(wino_diff_wei_);
+    free(ws_);
+}
+
+void gemm_wino_convolution_bwd_weights_t::execute_backward_weights() {
+    auto src = reinterpret_cast<const data_t *>(this->input_memory(0));
+    auto diff_dst = reinterpret_cast<const data_t *>(this->input_memory(1));
+    auto diff_weights = reinterpret_cast<data_t *>(this->memory(0));
+    auto diff_bias = reinterpret_cast<data_t *>(this->memory(1));
+
+    const auto &jcp = conf_.jcp_;
+    const wino_transforms_t wt(jcp.m);
+    const int alpha = jcp.alpha, alpha2 = alpha * alpha, m = jcp.m;
+    const int nb_oc = jcp.oc / simd_w;
+
+    float *dU = wino_diff_wei_;
+    float *V = ws_;
+    float *M = V + (size_t)alpha2 * jcp.tile_block * jcp.ic;
+
+    parallel_nd(alpha2, jcp.ic, [&](int a, int ic) {
+        array_set(dU + ((size_t)a * jcp.ic + ic) * jcp.oc, 0.f, jcp.oc);
+    });
+
+    /* dU[a] += sum_tiles dM[a]^T V[a], dM = A dY A^T being the gradient
+     * of the winograd domain output; the sgemm of each a is split by oc */
+    const int nthr = mkldnn_get_max_threads();
+    const int nb_occ = nstl::max(1, nstl::min(nb_oc, div_up(nthr, alpha2)));
+
+    for (int tblk = 0; tblk < jcp.nb_tile_blocks; ++tblk) {
+        const int tile_start = tblk * jcp.tile_block;
+        const int nt = nstl::min(jcp.ntiles - tile_start, jcp.tile_block);
+
+        parallel_nd(nt, [&](int t) {
+            const int tile = tile_start + t;
+            src_transform_tile(jcp, wt, src, tile, V, t);
+
+            int n, ty, tx;
+            tile_coords(jcp, tile, n, ty, tx);
+            const int y0 = ty * m, x0 = tx * m;
+            float dy[max_alpha * max_alpha * simd_w];
+            float dm[max_alpha * max_alpha * simd_w];
+            for (int ocb = 0; ocb < nb_oc; ++ocb) {
+                const float *d = diff_dst + (size_t)(n * nb_oc + ocb)
+                    * jcp.oh * jcp.ow * simd_w;
+                for (int i = 0; i < m; ++i)
+                for (int j = 0; j < m; ++j) {
+                    float *dd = &dy[(i * m + j) * simd_w];
+                    if (y0 + i < jcp.oh && x0 + j < jcp.ow) {
+                        const float *s = &d[((y0 + i) * jcp.ow + x0 + j)
+                            * simd_w];
+                        PRAGMA_OMP_SIMD()
+                        for (int v = 0; v < simd_w; ++v) dd[v] = s[v];
+                    } else {
+                        PRAGMA_OMP_SIMD()
+                        for (int v = 0; v < simd_w; ++v) dd[v] = 0.f;
+                    }
+                }
+                wt.diff_dst(dy, dm);
+                for (int a = 0; a < alpha2; ++a) {
+                    float *mm = &M[((size_t)a * jcp.tile_block + t) * jcp.oc
+                        + ocb * simd_w];
+                    PRAGMA_OMP_SIMD()
+                    for (int v = 0; v < simd_w; ++v)
+                        mm[v] = dm[a * simd_w + v];
+                }
+            }
+        });
+
+        parallel_nd(alpha2, nb_occ, [&](int a, int occ) {
+            int ocb_start{0}, ocb_end{0};
+            balance211(nb_oc, nb_occ, occ, ocb_start, ocb_end);
+            const int oc0 = ocb_start * simd_w;
+            const int ocw = (ocb_end - ocb_start) * simd_w;
+            if (ocw == 0) return;
+            const float one = 1.f;
+            extended_sgemm("N", "T", &ocw, &jcp.ic, &nt, &one,
+                    M + (size_t)a * jcp.tile_block * jcp.oc + oc0, &jcp.oc,
+                    V + (size_t)a * jcp.tile_block * jcp.ic, &jcp.ic,
+                    &one, dU + (size_t)a * jcp.ic * jcp.oc + oc0, &jcp.oc);
+        });
+    }
+
+    /* dW = G^T dU G */
+    const int IC = jcp.ic_without_padding, OC = jcp.oc_without_padding;
+    parallel_nd(IC, nb_oc, [&](int ic, int ocb) {
+        float du[max_alpha * max_alpha * simd_w], dw[3 * 3 * simd_w];
+        for (int a = 0; a < alpha2; ++a) {
+            const float *s = &dU[((size_t)a * jcp.ic + ic) * jcp.oc
+                + ocb * simd_w];
+            PRAGMA_OMP_SIMD()
+            for (int v = 0; v < simd_w; ++v) du[a * simd_w + v] = s[v];
+        }
+        wt.diff_wei(du, dw);
+        for (int v = 0; v < simd_w; ++v) {
+            const int oc = ocb * simd_w + v;
+            if (oc >= OC) break;
+            for (int k = 0; k < 9; ++k)
+                diff_weights[((size_t)oc * IC + ic) * 9 + k]
+                    = dw[k * simd_w + v];
+        }
+    });
+
+    if (jcp.with_bias) {
+        parallel_nd(nb_oc, [&](int ocb) {
+            float db[simd_w] = {0};
+            for (int n = 0; n < jcp.mb; ++n) {
+                const float *d = diff_dst + (size_t)(n * nb_oc + ocb)
+                    * jcp.oh * jcp.ow * simd_w;
+                for (int hw = 0; hw < jcp.oh * jcp.ow; ++hw) {
+                    PRAGMA_OMP_SIMD()
+                    for (int v = 0; v < simd_w; ++v)
+                        db[v] += d[hw * simd_w + v];
+                }
+            }
+            for (int v = 0; v < simd_w && ocb * simd_w + v < OC; ++v)
+                diff_bias[ocb * simd_w + v] = db[v];
+        });
+    }
+}
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
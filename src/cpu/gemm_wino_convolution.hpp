@@ -0,0 +1,363 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_GEMM_WINO_CONVOLUTION_HPP
+#define CPU_GEMM_WINO_CONVOLUTION_HPP
+
+#include "c_types_map.hpp"
+#include "cpu_convolution_pd.hpp"
+#include "cpu_engine.hpp"
+#include "cpu_isa_traits.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/* Winograd convolution F(m x m, 3 x 3), m = 2 or 4, for avx2 hosts.
+ *
+ * The input and output transforms work on 8-wide channel blocks of the
+ * nChw8c tensors; the element-wise products of the winograd domain are
+ * batched into alpha^2 independent sgemm calls per block of tiles:
+ *     M[a][tile][cout] = sum_cin V[a][tile][cin] * U[a][cin][cout]
+ *
+ * The same data pass serves backward by data: it is a forward pass over
+ * diff_dst with the kernel rotated by 180 degrees. Forward inference can
+ * take the weights pre-transformed by the wino_fmt reorder (aaOio for m = 2
+ * and OBaaIBOIio for m = 4, both blocked so that they are U[a][ic][oc]). */
+struct gemm_wino_conv_conf_t {
+    int m, alpha;
+    int mb;
+    /* channels of the input and of the output of the data pass, padded to
+     * the simd width; for backward by data these are oc and ic */
+    int ic, oc, ic_without_padding, oc_without_padding;
+    int ih, iw, oh, ow;
+    int t_pad, l_pad;
+    int tiles_h, tiles_w, ntiles;
+    int tile_block, nb_tile_blocks;
+    bool with_bias, with_sum, with_relu;
+    float relu_negative_slope;
+    bool wino_weights; /* weights are pre-transformed (wino_fmt) */
+};
+
+namespace gemm_wino_convolution_utils {
+
+status_t init_conf(gemm_wino_conv_conf_t &jcp, const convolution_desc_t &cd,
+        const memory_desc_wrapper &src_d, const memory_desc_wrapper &dst_d,
+        const primitive_attr_t &attr, bool with_relu = false,
+        float relu_negative_slope = 0.f);
+
+void init_wino_weights_md(const gemm_wino_conv_conf_t &jcp,
+        memory_desc_t &wei_md);
+
+/* memory a primitive allocates: the transformed weights (or their
+ * gradient), the padded bias and the work spaces of the threads */
+size_t scratchpad_size(const gemm_wino_conv_conf_t &jcp, prop_kind_t prop);
+
+}
+
+template <bool with_relu>
+struct _gemm_wino_convolution_fwd_t: public cpu_primitive_t {
+    struct pd_t: public _cpu_convolution_fwd_pd_t<with_relu> {
+        pd_t(engine_t *engine,
+                const typename pd_t::base_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const typename pd_t::base_class *hint_fwd_pd)
+            : _cpu_convolution_fwd_pd_t<with_relu>(engine, adesc, attr,
+                    hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("gemm_wino:", avx2, ""),
+                _gemm_wino_convolution_fwd_t<with_relu>);
+
+        virtual status_t init() override {
+            using namespace prop_kind;
+            using namespace memory_format;
+            assert(this->engine()->kind() == engine_kind::cpu);
+
+            bool ok = true
+                && mayiuse(avx2)
+                && this->set_default_params() == status::success
+                && utils::one_of(this->cdesc_().prop_kind, forward_training,
+                        forward_inference)
+                && this->cdesc_().alg_kind == alg_kind::convolution_winograd
+                && !this->has_zero_dim_memory()
+                && utils::everyone_is(data_type::f32,
+                        this->cdesc_().src_desc.data_type,
+                        this->cdesc_().weights_desc.data_type,
+                        this->cdesc_().dst_desc.data_type)
+                && utils::implication(this->with_bias(), data_type::f32
+                        == this->cdesc_().bias_desc.data_type)
+                && this->src_pd_.desc()->format == nChw8c
+                && this->dst_pd_.desc()->format == nChw8c
+                && this->is_wino_post_ops();
+            if (!ok) return status::unimplemented;
+
+            CHECK(gemm_wino_convolution_utils::init_conf(jcp_, this->cdesc_(),
+                        &this->src_pd_, &this->dst_pd_, *this->attr(),
+                        with_relu, this->negative_slope()));
+
+            /* inference takes the weights in the winograd domain unless the
+             * user asks for plain ones */
+            const bool inference
+                = this->cdesc_().prop_kind == forward_inference;
+            if (inference && this->weights_pd_.desc()->format != oihw) {
+                memory_desc_t expect_wei_md = *(this->weights_pd_.desc());
+                gemm_wino_convolution_utils::init_wino_weights_md(jcp_,
+                        expect_wei_md);
+                cpu_memory_t::pd_t new_weights_pd(this->engine_,
+                        &expect_wei_md);
+                if (this->weights_pd_.desc()->format == any)
+                    this->weights_pd_ = new_weights_pd;
+                if (!this->weights_pd_.is_equal(&new_weights_pd))
+                    return status::unimplemented;
+                jcp_.wino_weights = true;
+                return status::success;
+            }
+
+            if (this->weights_pd_.desc()->format == any)
+                CHECK(this->weights_pd_.set_format(oihw));
+            return this->weights_pd_.desc()->format == oihw
+                ? status::success : status::unimplemented;
+        }
+
+        gemm_wino_conv_conf_t jcp_;
+
+        virtual size_t scratchpad_size() const override {
+            return gemm_wino_convolution_utils::scratchpad_size(jcp_,
+                    this->cdesc_().prop_kind);
+        }
+
+    protected:
+        virtual status_t set_default_params() override {
+            using namespace memory_format;
+            if (this->src_pd_.desc()->format == any)
+                CHECK(this->src_pd_.set_format(nChw8c));
+            if (this->dst_pd_.desc()->format == any)
+                CHECK(this->dst_pd_.set_format(nChw8c));
+            if (this->bias_pd_.desc()->format == any)
+                CHECK(this->bias_pd_.set_format(x));
+            return status::success;
+        }
+
+        bool is_wino_post_ops() const {
+            auto const &po = this->attr()->post_ops_;
+            switch (po.len_) {
+            case 0: return true;
+            case 1: return po.entry_[0].is_relu() || po.entry_[0].is_sum();
+            case 2: return po.entry_[0].is_sum() && po.entry_[1].is_relu();
+            default: return false;
+            }
+        }
+    };
+
+    _gemm_wino_convolution_fwd_t(const pd_t *pd, const input_vector &inputs,
+            const output_vector &outputs);
+    ~_gemm_wino_convolution_fwd_t();
+
+    typedef typename prec_traits<data_type::f32>::type data_t;
+
+    virtual void execute(event_t *e) {
+        execute_forward();
+        e->set_state(event_t::ready);
+    }
+
+private:
+    void execute_forward();
+    pd_t conf_;
+
+    data_t *wino_wei_; /* U[alpha^2][ic][oc], unless given in wino_fmt */
+    data_t *padded_bias_;
+    size_t ws_per_thread_;
+    data_t *ws_;
+};
+
+using gemm_wino_convolution_fwd_t = _gemm_wino_convolution_fwd_t<false>;
+using gemm_wino_convolution_relu_t = _gemm_wino_convolution_fwd_t<true>;
+
+struct gemm_wino_convolution_bwd_data_t: public cpu_primitive_t {
+    struct pd_t: public cpu_convolution_bwd_data_pd_t {
+        pd_t(engine_t *engine,
+                const convolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_bwd_data_pd_t(engine, adesc, attr, hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("gemm_wino:", avx2, ""),
+                gemm_wino_convolution_bwd_data_t);
+
+        virtual status_t init() override {
+            using namespace memory_format;
+            assert(this->engine()->kind() == engine_kind::cpu);
+
+            bool ok = true
+                && mayiuse(avx2)
+                && this->set_default_params() == status::success
+                && this->desc()->prop_kind == prop_kind::backward_data
+                && this->desc()->alg_kind == alg_kind::convolution_winograd
+                && !this->has_zero_dim_memory()
+                && utils::everyone_is(data_type::f32,
+                        this->desc()->diff_src_desc.data_type,
+                        this->desc()->weights_desc.data_type,
+                        this->desc()->diff_dst_desc.data_type)
+                && this->diff_src_pd_.desc()->format == nChw8c
+                && this->diff_dst_pd_.desc()->format == nChw8c
+                && this->weights_pd_.desc()->format == oihw;
+            if (!ok) return status::unimplemented;
+
+            return gemm_wino_convolution_utils::init_conf(jcp_, *this->desc(),
+                    &this->diff_src_pd_, &this->diff_dst_pd_, *this->attr());
+        }
+
+        gemm_wino_conv_conf_t jcp_;
+
+        virtual size_t scratchpad_size() const override {
+            return gemm_wino_convolution_utils::scratchpad_size(jcp_,
+                    prop_kind::backward_data);
+        }
+
+    protected:
+        virtual status_t set_default_params() override {
+            using namespace memory_format;
+            if (this->diff_src_pd_.desc()->format == any)
+                CHECK(this->diff_src_pd_.set_format(nChw8c));
+            if (this->diff_dst_pd_.desc()->format == any)
+                CHECK(this->diff_dst_pd_.set_format(nChw8c));
+            if (this->weights_pd_.desc()->format == any)
+                CHECK(this->weights_pd_.set_format(oihw));
+            return status::success;
+        }
+    };
+
+    gemm_wino_convolution_bwd_data_t(const pd_t *pd,
+            const input_vector &inputs, const output_vector &outputs);
+    ~gemm_wino_convolution_bwd_data_t();
+
+    typedef typename prec_traits<data_type::f32>::type data_t;
+
+    virtual void execute(event_t *e) {
+        switch (conf_.desc()->prop_kind) {
+        case prop_kind::backward_data:
+            execute_backward_data();
+            break;
+        default:
+            assert(!"invalid prop_kind");
+        }
+        e->set_state(event_t::ready);
+    }
+
+private:
+    void execute_backward_data();
+    pd_t conf_;
+
+    data_t *wino_wei_; /* U[alpha^2][oc][ic] of the rotated kernel */
+    size_t ws_per_thread_;
+    data_t *ws_;
+};
+
+struct gemm_wino_convolution_bwd_weights_t: public cpu_primitive_t {
+    struct pd_t: public cpu_convolution_bwd_weights_pd_t {
+        pd_t(engine_t *engine,
+                const convolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_bwd_weights_pd_t(engine, adesc, attr,
+                    hint_fwd_pd)
+            , jcp_() {}
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("gemm_wino:", avx2, ""),
+                gemm_wino_convolution_bwd_weights_t);
+
+        virtual status_t init() override {
+            using namespace memory_format;
+            assert(this->engine()->kind() == engine_kind::cpu);
+
+            bool ok = true
+                && mayiuse(avx2)
+                && this->set_default_params() == status::success
+                && this->desc()->prop_kind == prop_kind::backward_weights
+                && this->desc()->alg_kind == alg_kind::convolution_winograd
+                && !this->has_zero_dim_memory()
+                && utils::everyone_is(data_type::f32,
+                        this->desc()->src_desc.data_type,
+                        this->desc()->diff_weights_desc.data_type,
+                        this->desc()->diff_dst_desc.data_type)
+                && utils::implication(this->with_bias(), data_type::f32
+                        == this->desc()->diff_bias_desc.data_type)
+                && this->src_pd_.desc()->format == nChw8c
+                && this->diff_dst_pd_.desc()->format == nChw8c
+                && this->diff_weights_pd_.desc()->format == oihw;
+            if (!ok) return status::unimplemented;
+
+            return gemm_wino_convolution_utils::init_conf(jcp_, *this->desc(),
+                    &this->src_pd_, &this->diff_dst_pd_, *this->attr());
+        }
+
+        gemm_wino_conv_conf_t jcp_;
+
+        virtual size_t scratchpad_size() const override {
+            return gemm_wino_convolution_utils::scratchpad_size(jcp_,
+                    prop_kind::backward_weights);
+        }
+
+    protected:
+        virtual status_t set_default_params() override {
+            using namespace memory_format;
+            if (this->src_pd_.desc()->format == any)
+                CHECK(this->src_pd_.set_format(nChw8c));
+            if (this->diff_dst_pd_.desc()->format == any)
+                CHECK(this->diff_dst_pd_.set_format(nChw8c));
+            if (this->diff_weights_pd_.desc()->format == any)
+                CHECK(this->diff_weights_pd_.set_format(oihw));
+            if (this->diff_bias_pd_.desc()->format == any)
+                CHECK(this->diff_bias_pd_.set_format(x));
+            return status::success;
+        }
+    };
+
+    gemm_wino_convolution_bwd_weights_t(const pd_t *pd,
+            const input_vector &inputs, const output_vector &outputs);
+    ~gemm_wino_convolution_bwd_weights_t();
+
+    typedef typename prec_traits<data_type::f32>::type data_t;
+
+    virtual void execute(event_t *e) {
+        switch (conf_.desc()->prop_kind) {
+        case prop_kind::backward_weights:
+            execute_backward_weights();
+            break;
+        default:
+            assert(!"invalid prop_kind");
+        }
+        e->set_state(event_t::ready);
+    }
+
+private:
+    void execute_backward_weights();
+    pd_t conf_;
+
+    data_t *wino_diff_wei_; /* dU[alpha^2][ic][oc] */
+    data_t *ws_;
+};
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,412 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <string.h>
+
+#include "mkldnn_types.h"
+
+#include "c_types_map.hpp"
+#include "jit_avx512_common_1x1_dw_convolution.hpp"
+#include "jit_generator.hpp"
+#include "mkldnn_thread.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace mkldnn::impl::status;
+using namespace mkldnn::impl::memory_format;
+using namespace mkldnn::impl::utils;
+
+namespace {
+/* the depthwise part is fixed: 3x3 kernel, padding 1 */
+constexpr int dw_ks = 3;
+constexpr int dw_pad = 1;
+}
+
+status_t jit_avx512_common_1x1_dw_convolution_fwd_t::pd_t::init() {
+    using namespace prop_kind;
+    assert(engine()->kind() == engine_kind::cpu);
+
+    if (!mayiuse(avx512_common)) return unimplemented;
+
+    /* post-ops: [relu] dw_conv [relu] */
+    const auto &p = attr()->post_ops_;
+    dw_idx_ = p.find(primitive_kind::convolution);
+    if (dw_idx_ == -1 || dw_idx_ > 1 || p.len_ > dw_idx_ + 2)
+        return unimplemented;
+    for (int i = 0; i < p.len_; ++i) {
+        if (i == dw_idx_) continue;
+        /* the 1x1 kernel only does relu with zero negative slope */
+        const bool ok = i < dw_idx_
+            ? p.entry_[i].is_relu() : p.entry_[i].is_relu(true, false);
+        if (!ok) return unimplemented;
+    }
+
+    attr_1x1_ = primitive_attr_t();
+    if (dw_idx_ == 1) {
+        const auto &e = p.entry_[0].eltwise;
+        CHECK(attr_1x1_.post_ops_.append_eltwise(e.scale, e.alg, e.alpha,
+                    e.beta));
+    }
+
+    bool ok = true
+        && set_default_params() == status::success
+        && one_of(cdesc_().prop_kind, forward_training, forward_inference)
+        && cdesc_().alg_kind == alg_kind::convolution_direct
+        && !has_zero_dim_memory()
+        && everyone_is(data_type::f32, cdesc_().src_desc.data_type,
+                cdesc_().weights_desc.data_type,
+                cdesc_().dst_desc.data_type)
+        && implication(with_bias(),
+                data_type::f32 == cdesc_().bias_desc.data_type)
+        && ndims() == 4
+        && !with_groups()
+        && src_pd_.desc()->format == nChw16c
+        && dst_pd_.desc()->format == nChw16c;
+    if (!ok) return unimplemented;
+
+    /* validate the 1x1 part on the full problem first */
+    CHECK(jit_avx512_common_1x1_conv_kernel::init_conf(jcp_, cdesc_(),
+                *src_pd_.desc(), *weights_pd_.desc(), *dst_pd_.desc(),
+                attr_1x1_, 1, false));
+
+    const int H = IH(), W = IW();
+    const int oc_padded = rnd_up(OC(), 16);
+
+    /* the band of 1x1 output rows and its source rows should stay in L2 */
+    const int L2_size = get_cache_size(2, true) / sizeof(data_t);
+    band_h_ = L2_size / 2 / ((rnd_up(IC(), 16) + oc_padded) * W);
+    band_h_ = nstl::min(H, nstl::max(band_h_, dw_ks + 1));
+
+    /* the 1x1 kernel runs over all the new rows of a band at once: generate
+     * it for a channel plane of a few rows more than the band, so that the
+     * plane is a multiple of the register blocking ur and the last,
+     * rounded up, block of pixels spills into the spare rows */
+    for (int extra_h = 1; ; ++extra_h) {
+        if (extra_h > 32) return unimplemented;
+        memory_desc_t src_band_md, dst_band_md;
+        const int plane = (band_h_ + extra_h) * W;
+        dims_t src_band_dims = { 1, IC(), 1, plane };
+        dims_t dst_band_dims = { 1, OC(), 1, plane };
+        CHECK(mkldnn_memory_desc_init(&src_band_md, 4, src_band_dims,
+                    data_type::f32, nChw16c));
+        CHECK(mkldnn_memory_desc_init(&dst_band_md, 4, dst_band_dims,
+                    data_type::f32, nChw16c));
+        CHECK(jit_avx512_common_1x1_conv_kernel::init_conf(jcp_, cdesc_(),
+                    src_band_md, *weights_pd_.desc(), dst_band_md, attr_1x1_,
+                    1, false));
+        if (true
+                && jcp_.ver != ver_4fma
+                && jcp_.bcast_block == jcp_.ur
+                && jcp_.ur_tail == 0
+                && extra_h * W >= jcp_.ur - 1)
+            break;
+    }
+    /* the band is read back by the depthwise kernel right away */
+    jcp_.use_vmovntps = false;
+
+    /* depthwise part */
+    const auto &dw = p.entry_[dw_idx_].dw_conv;
+    const int str = dw.stride;
+
+    jcp_dw_ = jit_conv_conf_t();
+    jcp_dw_.prop_kind = cdesc_().prop_kind;
+    jcp_dw_.ndims = 4;
+    jcp_dw_.mb = MB();
+    jcp_dw_.ngroups = jcp_dw_.ic = jcp_dw_.oc = oc_padded;
+    jcp_dw_.oc_without_padding = OC();
+    jcp_dw_.ih = jcp_.is / W;
+    jcp_dw_.iw = W;
+    jcp_dw_.oh = (H - 1) / str + 1;
+    jcp_dw_.ow = (W - 1) / str + 1;
+    jcp_dw_.id = jcp_dw_.od = jcp_dw_.kd = 1;
+    jcp_dw_.kh = jcp_dw_.kw = dw_ks;
+    jcp_dw_.t_pad = jcp_dw_.l_pad = dw_pad;
+    jcp_dw_.b_pad = (jcp_dw_.oh - 1) * str + dw_ks - H - dw_pad;
+    jcp_dw_.r_pad = (jcp_dw_.ow - 1) * str + dw_ks - W - dw_pad;
+    jcp_dw_.stride_h = jcp_dw_.stride_w = str;
+    jcp_dw_.dilate_h = jcp_dw_.dilate_w = 0;
+    jcp_dw_.src_fmt = nChw16c;
+    jcp_dw_.with_bias = dw.bias != nullptr;
+    jcp_dw_.with_sum = false;
+    if (dw_idx_ + 1 < p.len_) {
+        jcp_dw_.with_relu = true;
+        jcp_dw_.relu_negative_slope = p.entry_[dw_idx_ + 1].eltwise.alpha;
+    }
+    jcp_dw_.ur_w = 6;
+    jcp_dw_.ch_block = 16;
+    jcp_dw_.nb_ch = oc_padded / jcp_dw_.ch_block;
+    jcp_dw_.nb_ch_blocking = nstl::min(4, jcp_dw_.nb_ch);
+
+    /* the primitive writes the output of the depthwise convolution */
+    memory_desc_t dst_md;
+    dims_t dst_dims = { MB(), OC(), jcp_dw_.oh, jcp_dw_.ow };
+    CHECK(mkldnn_memory_desc_init(&dst_md, 4, dst_dims, data_type::f32,
+                nChw16c));
+    dst_pd_ = cpu_memory_t::pd_t(engine_, &dst_md);
+
+    return success;
+}
+
+jit_avx512_common_1x1_dw_convolution_fwd_t::
+jit_avx512_common_1x1_dw_convolution_fwd_t(const pd_t *pd,
+        const input_vector &inputs, const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd)
+    , kernel_(nullptr), kernel_dw_(nullptr), ws_per_thread_(0)
+    , ws_(nullptr), padded_bias_(nullptr), dw_weights_(nullptr)
+    , dw_bias_(nullptr)
+{
+    const auto &jcp = conf_.jcp_;
+    const auto &jcp_dw = conf_.jcp_dw_;
+
+    kernel_ = new jit_avx512_common_1x1_conv_kernel(jcp, conf_.attr_1x1_);
+    kernel_dw_ = new jit_uni_dw_conv_fwd_kernel_f32<avx512_common>(jcp_dw);
+
+    /* per thread: a band of 1x1 source rows and a band of 1x1 output rows */
+    ws_per_thread_ = (size_t)(jcp.ic + jcp.oc) * jcp.is;
+    const size_t ws_size = ws_per_thread_ * mkldnn_get_max_threads();
+    ws_ = (data_t *)malloc(sizeof(data_t) * ws_size, 64);
+    /* the spare rows are computed on but never read: keep them finite */
+    utils::array_set(ws_, 0.f, ws_size);
+
+    if (conf_.want_padded_bias()) {
+        padded_bias_ = (data_t *)malloc(sizeof(data_t) * jcp.oc, 64);
+        for (int oc = jcp.oc_without_padding; oc < jcp.oc; ++oc)
+            padded_bias_[oc] = 0;
+    }
+
+    dw_weights_ = (data_t *)malloc(
+            sizeof(data_t) * jcp_dw.oc * dw_ks * dw_ks, 64);
+    if (jcp_dw.with_bias)
+        dw_bias_ = (data_t *)malloc(sizeof(data_t) * jcp_dw.oc, 64);
+}
+
+jit_avx512_common_1x1_dw_convolution_fwd_t::
+~jit_avx512_common_1x1_dw_convolution_fwd_t() {
+    delete kernel_;
+    delete kernel_dw_;
+    free(ws_);
+    free(padded_bias_);
+    free(dw_weights_);
+    free(dw_bias_);
+}
+
+void jit_avx512_common_1x1_dw_convolution_fwd_t::execute_forward() {
+    auto src = reinterpret_cast<const data_t *>(this->input_memory(0));
+    auto weights = reinterpret_cast<const data_t *>(this->input_memory(1));
+    auto bias = reinterpret_cast<const data_t *>(this->input_memory(2));
+    auto dst = reinterpret_cast<data_t *>(this->memory());
+
+    const auto &jcp = kernel_->jcp;
+    const auto &jcp_dw = kernel_dw_->jcp;
+
+    if (conf_.want_padded_bias()) {
+        for (int oc = 0; oc < jcp.oc_without_padding; ++oc)
+            padded_bias_[oc] = bias[oc];
+        bias = padded_bias_;
+    }
+
+    /* the dw_conv weights are passed through the post-op and may change
+     * between executions: repack goihw to Goihw16g on every call */
+    const auto &dw = conf_.attr()->post_ops_.entry_[conf_.dw_idx_].dw_conv;
+    const int C = jcp_dw.oc_without_padding;
+    const int ch_blk = jcp_dw.ch_block;
+    const int ks = dw_ks * dw_ks;
+    for (int c = 0; c < jcp_dw.oc; ++c)
+    for (int k = 0; k < ks; ++k)
+        dw_weights_[((c / ch_blk) * ks + k) * ch_blk + c % ch_blk]
+            = c < C ? dw.weights[c * ks + k] : 0.f;
+    if (jcp_dw.with_bias)
+        for (int c = 0; c < jcp_dw.oc; ++c)
+            dw_bias_[c] = c < C ? dw.bias[c] : 0.f;
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        execute_forward_thr(ithr, nthr, src, weights, bias, dst);
+    });
+}
+
+void jit_avx512_common_1x1_dw_convolution_fwd_t::execute_forward_thr(
+        const int ithr, const int nthr, const data_t *src,
+        const data_t *weights, const data_t *bias, data_t *dst) {
+    const memory_desc_wrapper src_d(conf_.src_pd());
+    const memory_desc_wrapper dst_d(conf_.dst_pd());
+    const memory_desc_wrapper weights_d(conf_.weights_pd(0));
+
+    const auto &jcp = kernel_->jcp;
+    const auto &jcp_dw = kernel_dw_->jcp;
+
+    const int H = conf_.IH(), W = conf_.IW();
+    const int band_h = conf_.band_h_;
+    const int str_h = jcp_dw.stride_h, str_w = jcp_dw.stride_w;
+    const int nb_ic = jcp.nb_reduce, nb_oc = jcp.nb_load;
+    const int row = W * jcp.oc_block;
+    /* stride between the channel blocks of the band buffers */
+    const size_t band = (size_t)jcp.is * jcp.oc_block;
+
+    data_t *ws_src = ws_ + ithr * ws_per_thread_;
+    data_t *ws_dst = ws_src + nb_ic * band;
+
+    auto step = [](int default_step, int remaining, int tail_step) {
+        assert(default_step <= tail_step);
+        return remaining < tail_step ? remaining : default_step;
+    };
+
+    /* 1x1 output rows [h, h + nrows) of image n go to band row r0 */
+    auto compute_1x1 = [&](int n, int h, int nrows, int r0) {
+        for (int icb = 0; icb < nb_ic; ++icb)
+            memcpy(ws_src + icb * band, &src[src_d.blk_off(n, icb, h, 0)],
+                    sizeof(data_t) * nrows * row);
+
+        /* the pixels past the last row are computed into the spare rows */
+        auto p = jit_1x1_conv_call_s();
+        p.bcast_dim = rnd_up(nrows * W, jcp.ur);
+        int load_step = 0;
+        for (int ocb = 0; ocb < nb_oc; ocb += load_step) {
+            load_step = step(jcp.nb_load_blocking, nb_oc - ocb,
+                    jcp.nb_load_blocking_max);
+            p.load_dim = this_block_size(ocb * jcp.oc_block, jcp.oc,
+                    load_step * jcp.oc_block);
+            p.output_data = ws_dst + ocb * band + r0 * row;
+            p.bias_data = &bias[ocb * jcp.oc_block];
+            for (int icb = 0; icb < nb_ic; icb += jcp.nb_reduce_blocking) {
+                const int nb_ic_blocking_step = nstl::min(
+                        icb + jcp.nb_reduce_blocking, nb_ic) - icb;
+                p.first_last_flag = 0
+                    | (icb == 0 ? FLAG_REDUCE_FIRST : 0)
+                    | (icb + nb_ic_blocking_step >= nb_ic
+                            ? FLAG_REDUCE_LAST : 0);
+                p.reduce_dim = this_block_size(icb * jcp.ic_block, jcp.ic,
+                        nb_ic_blocking_step * jcp.ic_block);
+                p.load_data = &weights[weights_d.blk_off(ocb, icb)];
+                p.bcast_data = ws_src + icb * band;
+                kernel_->jit_ker(&p);
+            }
+        }
+    };
+
+    /* the band holds 1x1 output rows [hb, he) */
+    auto kernel_params = [&](int ur_w_step, int ow, int oh, int ih, int kh,
+            int kh_padding, int hb, int ch, int n) {
+        auto par_conv = jit_conv_call_s();
+
+        const int i_l_overflow = nstl::max(0, jcp_dw.l_pad - ow * str_w);
+        const int i_r_overflow = nstl::max(W,
+                ow * str_w + jcp_dw.kw - jcp_dw.l_pad) - W;
+        const int iw = nstl::max(ow * str_w - jcp_dw.l_pad, 0);
+        const int kw = i_l_overflow;
+        const int kw_padding = jcp_dw.kw - i_l_overflow - i_r_overflow;
+
+        par_conv.src = ws_dst + ch * band + (ih - hb) * row
+            + iw * jcp_dw.ch_block;
+        par_conv.dst = &dst[dst_d.blk_off(n, ch, oh, ow)];
+        par_conv.filt = dw_weights_
+            + ((ch * jcp_dw.kh + kh) * jcp_dw.kw + kw) * jcp_dw.ch_block;
+        if (jcp_dw.with_bias)
+            par_conv.bias = dw_bias_ + ch * jcp_dw.ch_block;
+
+        par_conv.kh_padding = (size_t)nstl::max(0, kh_padding);
+        par_conv.kw_padding = (size_t)nstl::max(0, kw_padding);
+        par_conv.ur_w = (size_t)ur_w_step;
+        par_conv.ch_blocks = nstl::min(ch + jcp_dw.nb_ch_blocking,
+                jcp_dw.nb_ch) - ch;
+
+        return par_conv;
+    };
+
+    const int work_amount = jcp_dw.mb * jcp_dw.oh;
+    int start{0}, end{0};
+    balance211(work_amount, nthr, ithr, start, end);
+
+    int n{0}, oh{0};
+    nd_iterator_init(start, n, jcp_dw.mb, oh, jcp_dw.oh);
+
+    int hb = 0, he = 0, n_cur = -1;
+    for (int iwork = start; iwork < end; ++iwork) {
+        const int i_t_overflow = nstl::max(0, jcp_dw.t_pad - oh * str_h);
+        const int i_b_overflow = nstl::max(H,
+                oh * str_h + jcp_dw.kh - jcp_dw.t_pad) - H;
+        const int ih = nstl::max(oh * str_h - jcp_dw.t_pad, 0);
+        const int kh = i_t_overflow;
+        const int kh_padding = jcp_dw.kh - i_t_overflow - i_b_overflow;
+        const int ih_end = ih + kh_padding;
+
+        if (n != n_cur || ih > he) {
+            n_cur = n;
+            hb = he = ih;
+        }
+
+        if (ih_end > he) {
+            if (ih_end - hb > band_h) {
+                /* keep the rows still needed at the top of the band */
+                const int keep = he - ih;
+                if (keep > 0)
+                    for (int ocb = 0; ocb < nb_oc; ++ocb)
+                        memmove(ws_dst + ocb * band,
+                                ws_dst + ocb * band + (ih - hb) * row,
+                                sizeof(data_t) * keep * row);
+                hb = ih;
+            }
+            /* do not compute past the last row this thread needs */
+            const int oh_last = (n == (end - 1) / jcp_dw.oh)
+                ? (end - 1) % jcp_dw.oh : jcp_dw.oh - 1;
+            const int h_last = nstl::min(H,
+                    oh_last * str_h + jcp_dw.kh - jcp_dw.t_pad);
+            const int nrows = nstl::min(hb + band_h, h_last) - he;
+            compute_1x1(n, he, nrows, he - hb);
+            he += nrows;
+        }
+
+        for (int ch = 0; ch < jcp_dw.nb_ch; ch += jcp_dw.nb_ch_blocking) {
+            // left border
+            int ow = 0;
+            const int l_border = nstl::min(div_up(jcp_dw.l_pad, str_w),
+                    jcp_dw.ow);
+            for (; ow < l_border; ow++) {
+                auto par_conv = kernel_params(1, ow, oh, ih, kh, kh_padding,
+                        hb, ch, n);
+                kernel_dw_->jit_ker(&par_conv);
+            }
+
+            // main loop
+            const int ur_w_step = (W - jcp_dw.kw + jcp_dw.l_pad) / str_w
+                - ow + 1;
+            if (ur_w_step > 0) {
+                auto par_conv = kernel_params(ur_w_step, ow, oh, ih, kh,
+                        kh_padding, hb, ch, n);
+                kernel_dw_->jit_ker(&par_conv);
+                ow += ur_w_step;
+            }
+
+            // right border
+            for (; ow < jcp_dw.ow; ow++) {
+                auto par_conv = kernel_params(1, ow, oh, ih, kh, kh_padding,
+                        hb, ch, n);
+                kernel_dw_->jit_ker(&par_conv);
+            }
+        }
+
+        nd_iterator_step(n, jcp_dw.mb, oh, jcp_dw.oh);
+    }
+}
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,115 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_JIT_AVX512_COMMON_1x1_DW_CONVOLUTION_HPP
+#define CPU_JIT_AVX512_COMMON_1x1_DW_CONVOLUTION_HPP
+
+#include "c_types_map.hpp"
+#include "cpu_convolution_pd.hpp"
+#include "cpu_engine.hpp"
+#include "jit_avx512_common_1x1_conv_kernel.hpp"
+#include "jit_uni_dw_conv_kernel_f32.hpp"
+#include "mkldnn_thread.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/* 1x1 convolution followed by the 3x3 depthwise convolution of a dw_conv
+ * post-op (expand + depthwise part of inverted residual blocks).
+ *
+ * The output of the 1x1 convolution is never written to memory: each thread
+ * computes it a band of band_h_ rows at a time into a buffer sized to stay in
+ * L2, and the depthwise kernel consumes the band right away. When the
+ * depthwise window moves past the band, the rows it still needs are moved to
+ * the top of the buffer and the rest of the band is refilled.
+ *
+ * The 1x1 kernel is generated for a band-sized problem (channel planes of
+ * a few rows more than band_h_), so the input rows of a band are copied into
+ * a per-thread buffer first; this is cheap as the 1x1 convolution expands
+ * the number of channels. */
+struct jit_avx512_common_1x1_dw_convolution_fwd_t: public cpu_primitive_t {
+    struct pd_t: public cpu_convolution_fwd_pd_t {
+        pd_t(engine_t *engine, const convolution_desc_t *adesc,
+                const primitive_attr_t *attr,
+                const convolution_fwd_pd_t *hint_fwd_pd)
+            : cpu_convolution_fwd_pd_t(engine, adesc, attr, hint_fwd_pd)
+            , jcp_(), jcp_dw_(), attr_1x1_(), dw_idx_(-1), band_h_(0) {}
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("jit_1x1_dw:", avx512_common, ""),
+                jit_avx512_common_1x1_dw_convolution_fwd_t);
+
+        virtual status_t init() override;
+
+        jit_1x1_conv_conf_t jcp_;
+        jit_conv_conf_t jcp_dw_;
+        primitive_attr_t attr_1x1_;
+        int dw_idx_;
+        int band_h_;
+
+    protected:
+        virtual status_t set_default_params() override {
+            using namespace memory_format;
+            if (src_pd_.desc()->format == any)
+                CHECK(src_pd_.set_format(nChw16c));
+            if (dst_pd_.desc()->format == any)
+                CHECK(dst_pd_.set_format(nChw16c));
+            if (weights_pd_.desc()->format == any)
+                CHECK(weights_pd_.set_format(OIhw16i16o));
+            if (bias_pd_.desc()->format == any)
+                CHECK(bias_pd_.set_format(x));
+            return status::success;
+        }
+    };
+
+    jit_avx512_common_1x1_dw_convolution_fwd_t(const pd_t *pd,
+            const input_vector &inputs, const output_vector &outputs);
+    ~jit_avx512_common_1x1_dw_convolution_fwd_t();
+
+    typedef prec_traits<data_type::f32>::type data_t;
+
+    virtual void execute(event_t *e) {
+        execute_forward();
+        e->set_state(event_t::ready);
+    }
+
+private:
+    void execute_forward();
+    void execute_forward_thr(const int ithr, const int nthr,
+            const data_t *src, const data_t *weights, const data_t *bias,
+            data_t *dst);
+
+    pd_t conf_;
+    jit_avx512_common_1x1_conv_kernel *kernel_;
+    jit_uni_dw_conv_fwd_kernel_f32<avx512_common> *kernel_dw_;
+
+    size_t ws_per_thread_;
+    data_t *ws_;
+    data_t *padded_bias_;
+    /* dw_conv weights and bias repacked to Goihw16g and padded */
+    data_t *dw_weights_;
+    data_t *dw_bias_;
+};
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -71,7 +71,7 @@ inline bool is_1stconv(const jit_conv_conf_t &jcp) {
 void jit_avx512_common_conv_fwd_kernel::prepare_output(int ur_w)
 {
     for (int k = 0; k < jcp.nb_oc_blocking; k++)
-        for (int j = 0; j < ur_w; j++) {
+        for (int j = 0; j < ur_w * jcp.mb_block; j++) {
             Zmm zmm = zmm_out(j, k);
             vpxord(zmm, zmm, zmm);
             size_t aux_output_offset = get_output_offset(j, k);
@@ -95,7 +95,7 @@ void jit_avx512_common_conv_fwd_kernel::store_output(int ur_w)
     }
 
     for (int k = 0; k < jcp.nb_oc_blocking; k++)
-        for (int j = 0; j < ur_w; j++) {
+        for (int j = 0; j < ur_w * jcp.mb_block; j++) {
             Zmm zmm = zmm_out(j, k);
             size_t aux_output_offset = get_output_offset(j, k);
             vadd(zmm,
@@ -113,7 +113,7 @@ void jit_avx512_common_conv_fwd_kernel::store_output(int ur_w)
     if (jcp.with_bias) {
         for (int k = 0; k < jcp.nb_oc_blocking; k++) {
             int bias_offset = jcp.typesize_out * k * jcp.oc_block;
-            for (int j = 0; j < ur_w; j++) {
+            for (int j = 0; j < ur_w * jcp.mb_block; j++) {
                 Zmm zmm = zmm_out(j, k);
                 vadd(zmm, EVEX_compress_addr(reg_bias, bias_offset));
             }
@@ -134,7 +134,7 @@ void jit_avx512_common_conv_fwd_kernel::store_output(int ur_w)
         cmp(reg_channel, jcp.nb_ic - 1);
         jl(store_label, T_NEAR);
         for (int k = 0; k < jcp.nb_oc_blocking; k++)
-            for (int j = 0; j < ur_w; j++){
+            for (int j = 0; j < ur_w * jcp.mb_block; j++){
                 Opmask kmask = Opmask(7);
                 Zmm zmm = zmm_out(j, k);
                 vcmp(kmask, zmm, zmm_zero, _cmp_lt_os);
@@ -144,10 +144,9 @@ void jit_avx512_common_conv_fwd_kernel::store_output(int ur_w)
 
     L(store_label);
     for (int k = 0; k < jcp.nb_oc_blocking; k++)
-        for (int j = 0; j < ur_w; j++) {
+        for (int j = 0; j < ur_w * jcp.mb_block; j++) {
             Zmm zmm = zmm_out(j, k);
-            size_t aux_output_offset = (size_t)typesize *
-                ((size_t)k * jcp.od * jcp.oh * jcp.ow + j) * jcp.oc_block;
+            size_t aux_output_offset = get_output_offset(j, k);
             vmovups(EVEX_compress_addr_safe(reg_out, aux_output_offset,
                         reg_out_long_offt), zmm);
             mic_prefetcht0(EVEX_compress_addr_safe(reg_out_prf,
@@ -741,6 +740,9 @@ void jit_avx512_common_conv_fwd_kernel::compute_loop_fma_core(int ur_w,
                 * inp_mul + (size_t)ic
                 * (!jcp.is_1stconv ? 1 : (size_t)jcp.iw * jcp.ih * jcp.id));
     };
+    const size_t inp_mb_shift = (size_t)jcp.typesize_in * jcp.ngroups
+        * jcp.ic * jcp.id * jcp.ih * jcp.iw;
+    assert(jcp.mb_block == 1 || jcp.kernel_kind == embd_bcast);
 
     prepare_output(ur_w);
 
@@ -796,13 +798,16 @@ void jit_avx512_common_conv_fwd_kernel::compute_loop_fma_core(int ur_w,
                     if (jj_end - jj_start > 0)
                         vmovups(zmm_wei, EVEX_compress_addr(aux_reg_ker,
                             aux_kernel_offset));
+                    /* the weights are reused for the mb_block images */
+                    for (int mb = 0; mb < jcp.mb_block; mb++)
                     for (int jj = jj_start; jj < jj_end; jj++)
                         if (jcp.kernel_kind == expl_bcast)
                             vfmadd231ps(zmm_out(jj, ii),
                                 zmm_inp(jj, nb_oc_block), zmm_wei);
                         else {
-                            size_t aux_input_offset = input_offset(jj, ic, ki);
-                            vfmadd231ps(zmm_out(jj, ii), zmm_wei,
+                            size_t aux_input_offset = input_offset(jj, ic, ki)
+                                + mb * inp_mb_shift;
+                            vfmadd231ps(zmm_out(mb * ur_w + jj, ii), zmm_wei,
                                 EVEX_compress_addr_safe(aux_reg_inp,
                                 aux_input_offset, reg_long_offt, true));
                         }
@@ -1180,6 +1185,7 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(
     jcp.oc_block = simd_w;
     jcp.ic_block = jcp.is_1stconv ? jcp.ic : simd_w;
     jcp.aligned_threads = 0;
+    jcp.mb_block = 1;
 
     bool ok_to_pad_channels = true
         && jcp.ngroups == 1
@@ -1473,6 +1479,31 @@ status_t jit_avx512_common_conv_fwd_kernel::init_conf(
 
     jcp.ur_w_tail = jcp.ow % jcp.ur_w;
 
+    /* When the whole row fits into a tile and registers are left, the tile
+     * spans several images so that every loaded weight vector is used for
+     * all of them. The kernel is fully unrolled over kw and ic_block, so the
+     * number of fmas is capped to keep it in the decoded icache: beyond that
+     * (e.g. 7x7 images) and for strided inputs it was measured to be slower
+     * than one image per tile */
+    if (jcp.ver == ver_fma && mayiuse(avx512_core) && ndims == 4
+            && !jcp.is_1stconv && jcp.kernel_kind == embd_bcast
+            && jcp.nb_oc_blocking > 1 && jcp.ur_w == jcp.ow
+            && jcp.stride_w == 1) {
+        const int max_unrolled_fmas = 1200;
+        const int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
+        const int tile = jcp.ur_w * jcp.nb_oc_blocking;
+        for (int mb_block = nstl::min(regs / tile,
+                    max_unrolled_fmas / (tile * jcp.kw * jcp.ic_block));
+                mb_block > 1; --mb_block) {
+            const int work_amount
+                = jcp.mb / mb_block * jcp.ngroups * oc_chunks * jcp.oh;
+            if (jcp.mb % mb_block == 0 && work_amount >= nthreads) {
+                jcp.mb_block = mb_block;
+                break;
+            }
+        }
+    }
+
     args_ok = true
         && jcp.l_pad <= jcp.ur_w
         && jcp.ic <= src_d.blocking_desc().padding_dims[1]
@@ -114,7 +114,7 @@ private:
     }
 
     inline Xbyak::Zmm zmm_out(int i_ur, int i_oc) {
-        int idx = i_ur + i_oc * jcp.ur_w;
+        int idx = i_ur + i_oc * jcp.ur_w * jcp.mb_block;
         assert(idx < ker_reg_base_idx);
         return Xbyak::Zmm(idx);
     }
@@ -173,9 +173,13 @@ private:
             vmulps(zmm_dst | kmask, zmm_src1, zmm_src2);
     }
 
+    /* with minibatch blocking oi runs over the ur_w == ow points of the
+     * mb_block images of the tile */
     inline size_t get_output_offset(int oi, int n_oc_block) {
-        return (size_t)jcp.typesize_out * ((size_t)n_oc_block * jcp.oh
-            * jcp.ow * jcp.od + oi) * jcp.oc_block;
+        const size_t mb = oi / jcp.ow, ow = oi % jcp.ow;
+        return (size_t)jcp.typesize_out * (mb * jcp.ngroups * jcp.oc
+            * jcp.od * jcp.oh * jcp.ow + ((size_t)n_oc_block * jcp.oh
+            * jcp.ow * jcp.od + ow) * jcp.oc_block);
     }
 
     inline size_t get_input_offset(int ki, int ic, int oi, int pad_l) {
@@ -18,6 +18,7 @@
 #include "c_types_map.hpp"
 #include "jit_avx512_common_convolution.hpp"
 #include "mkldnn_thread.hpp"
+#include "numa.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
@@ -186,7 +187,8 @@ void _jit_avx512_common_convolution_fwd_t
     assert(jcp.nb_oc % jcp.nb_oc_blocking == 0);
 
     int oc_chunks = jcp.nb_oc / jcp.nb_oc_blocking;
-    int work_amount = jcp.mb * jcp.ngroups * oc_chunks * jcp.oh;
+    int nb_mb = jcp.mb / jcp.mb_block;
+    int work_amount = nb_mb * jcp.ngroups * oc_chunks * jcp.oh;
 
     int nthr;
     if (jcp.aligned_threads)
@@ -214,18 +216,19 @@ void _jit_avx512_common_convolution_fwd_t
 
         for (int icb_l2 = 0 ; icb_l2 < jcp.nb_ic; icb_l2 += jcp.nb_ic_L2) {
             start = start_copy;
-            int n{0}, g{0}, occ{0}, oh_s{0};
+            int nb{0}, g{0}, occ{0}, oh_s{0};
 
             if (jcp.loop_order == loop_cgn)
                 nd_iterator_init(start,
-                    occ, oc_chunks, g, jcp.ngroups, n, jcp.mb, oh_s, jcp.oh);
+                    occ, oc_chunks, g, jcp.ngroups, nb, nb_mb, oh_s, jcp.oh);
             else if (jcp.loop_order == loop_gnc)
                 nd_iterator_init(start,
-                    g, jcp.ngroups, n, jcp.mb, occ, oc_chunks, oh_s, jcp.oh);
+                    g, jcp.ngroups, nb, nb_mb, occ, oc_chunks, oh_s, jcp.oh);
             else
                 assert(!"unsupported loop order");
 
             while (start < end) {
+                int n = nb * jcp.mb_block;
                 int ocb = occ * jcp.nb_oc_blocking;
                 int g_ocb = g * jcp.nb_oc + ocb;
                 int g_oc = g_ocb * jcp.oc_block;
@@ -279,10 +282,10 @@ void _jit_avx512_common_convolution_fwd_t
 
                 if (jcp.loop_order == loop_cgn)
                     nd_iterator_jump(start, end,
-                      occ, oc_chunks, g, jcp.ngroups, n, jcp.mb, oh_s, jcp.oh);
+                      occ, oc_chunks, g, jcp.ngroups, nb, nb_mb, oh_s, jcp.oh);
                 else if (jcp.loop_order == loop_gnc)
                     nd_iterator_jump(start, end,
-                      g, jcp.ngroups, n, jcp.mb, occ, oc_chunks, oh_s, jcp.oh);
+                      g, jcp.ngroups, nb, nb_mb, occ, oc_chunks, oh_s, jcp.oh);
                 else
                     assert(!"unsupported loop order");
             }
@@ -1317,108 +1320,107 @@ void jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
 template <data_type_t src_type, data_type_t diff_dst_type,
           data_type_t diff_weights_type>
 void jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
-    diff_weights_type>::reduce_diff_weights(const thread_info_t *ti) {
+    diff_weights_type>::accumulate_diff_weights(const thread_info_t *ti,
+            diff_weights_data_t *dst, const diff_weights_data_t *src,
+            int start, int end) {
     const memory_desc_wrapper diff_weights_d(conf_.diff_weights_pd(0));
 
     const auto &jcp = kernel_->jcp;
-    const int wei_size = jcp.ngroups * jcp.oc * jcp.ic * jcp.kh * jcp.kw;
-    const int bia_size = jcp.ngroups * jcp.oc;
-    const diff_weights_data_t *diff_bias_ws
-        = ws_reduction_ + (nthr_mb_ - 1) * wei_size;
-
-    /* diff_weights[:] += sum(ws_reduction_[thr_mb][:]) */
-    simple_barrier::barrier(&reduction_bctx_, nthr_);
-
-    const int ic_b_kh_work = ti->ic_b_work * jcp.kh;
-    const int work = ti->g_work * ti->oc_b_work * ic_b_kh_work;
-
-    int start{0}, end{0};
-    balance211(work, nthr_mb_, ti->ithr_mb, start, end);
-    if (start == end) return;
-
-    for (int thr_mb = 1; thr_mb < nthr_mb_; ++thr_mb) {
-        int w = start;
-        int sub_g_start{0}, sub_oc_b_start{0}, sub_ic_b_kh_start{0};
-        nd_iterator_init(w, sub_g_start, ti->g_work, sub_oc_b_start,
-                ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
-        while (w < end) {
-            const int g = ti->g_start + sub_g_start;
-            const int oc_b = ti->oc_b_start + sub_oc_b_start;
-            const int ic_b = ti->ic_b_start + sub_ic_b_kh_start / jcp.kh;
-            const int kh = sub_ic_b_kh_start % jcp.kh;
-
-            const int acc_size
-                = nstl::min(end - w, ic_b_kh_work - sub_ic_b_kh_start)
-                * jcp.kw * jcp.ic_block * jcp.oc_block;
-
-            const size_t off
-                = wht_blk_off(diff_weights_d, g, oc_b, ic_b, kh);
-
-            diff_weights_data_t *d
-                = (diff_weights_data_t *)ti->diff_weights + off;
-            diff_weights_data_t *s
-                = ws_reduction_ + (thr_mb - 1) * wei_size + off;
-
-            acc_ker_->accumulate(d, s, acc_size);
-
-            nd_iterator_jump(w, end, sub_g_start, ti->g_work, sub_oc_b_start,
-                    ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
-        }
-
-        if (jcp.with_bias && jcp.is_1stconv && jcp.ver == ver_4fma) {
-            if (ti->ithr == 0)
-                acc_ker_->accumulate((diff_weights_data_t *)ti->diff_bias,
-                    diff_bias_ws, bia_size);
-            diff_bias_ws += bia_size;
-        }
+    const bool is_3d = conf_.ndims() == 5;
+
+    /* the work is split over (g, oc_b, ic_b, kh) or, in 3D, (g, oc_b, ic_b,
+     * kd) blocks of the weights of the thread */
+    const int nk = is_3d ? jcp.kd : jcp.kh;
+    const int ic_b_k_work = ti->ic_b_work * nk;
+    const int k_block = jcp.kw * jcp.ic_block * jcp.oc_block
+        * (is_3d ? jcp.kh : 1);
+
+    int w = start;
+    int sub_g_start{0}, sub_oc_b_start{0}, sub_ic_b_k_start{0};
+    nd_iterator_init(w, sub_g_start, ti->g_work, sub_oc_b_start,
+            ti->oc_b_work, sub_ic_b_k_start, ic_b_k_work);
+    while (w < end) {
+        const int g = ti->g_start + sub_g_start;
+        const int oc_b = ti->oc_b_start + sub_oc_b_start;
+        const int ic_b = ti->ic_b_start + sub_ic_b_k_start / nk;
+        const int k = sub_ic_b_k_start % nk;
+
+        const int acc_size
+            = nstl::min(end - w, ic_b_k_work - sub_ic_b_k_start) * k_block;
+
+        const size_t off = wht_blk_off(diff_weights_d, g, oc_b, ic_b, k);
+        acc_ker_->accumulate(dst + off, src + off, acc_size);
+
+        nd_iterator_jump(w, end, sub_g_start, ti->g_work, sub_oc_b_start,
+                ti->oc_b_work, sub_ic_b_k_start, ic_b_k_work);
     }
 }
 
 template <data_type_t src_type, data_type_t diff_dst_type,
           data_type_t diff_weights_type>
 void jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
-    diff_weights_type>::reduce_diff_weights_3d(const thread_info_t *ti) {
-    const memory_desc_wrapper diff_weights_d(conf_.diff_weights_pd(0));
-
+    diff_weights_type>::reduce_diff_weights(const thread_info_t *ti) {
     const auto &jcp = kernel_->jcp;
-    const int wei_size = jcp.ngroups * jcp.oc * jcp.ic * jcp.kh * jcp.kw
-        * jcp.kd;
+    const size_t wei_size = (size_t)jcp.ngroups * jcp.oc * jcp.ic * jcp.kh
+        * jcp.kw * jcp.kd;
+    const int bia_size = jcp.ngroups * jcp.oc;
+
+    /* the partial result of the minibatch thread thr_mb */
+    auto partial = [&](int thr_mb) {
+        return thr_mb == 0
+            ? (diff_weights_data_t *)ti->diff_weights
+            : ws_reduction_ + (thr_mb - 1) * wei_size;
+    };
+
+    const int nk = conf_.ndims() == 5 ? jcp.kd : jcp.kh;
+    const int work = ti->g_work * ti->oc_b_work * ti->ic_b_work * nk;
 
-    /* diff_weights[:] += sum(ws_reduction_[thr_mb][:]) */
+    /* diff_weights[:] += sum(ws_reduction_[thr_mb][:])
+     *
+     * With several minibatch teams (one per NUMA node, see balance()) the
+     * partial results are first summed up within each team into the
+     * partial of its first thread, and only those partials cross the teams:
+     * every thread then reads nthr_mb_teams_ remote partials instead of
+     * nthr_mb_ * (nthr_mb_teams_ - 1) / nthr_mb_teams_ of them. */
     simple_barrier::barrier(&reduction_bctx_, nthr_);
 
-    const int ic_b_kh_work = ti->ic_b_work * jcp.kd;
-    const int work = ti->g_work * ti->oc_b_work * ic_b_kh_work;
+    if (nthr_mb_teams_ > 1) {
+        const int team = ti->ithr_mb * nthr_mb_teams_ / nthr_mb_;
+        int team_start{0}, team_end{0};
+        balance211(nthr_mb_, nthr_mb_teams_, team, team_start, team_end);
+
+        int start{0}, end{0};
+        balance211(work, team_end - team_start, ti->ithr_mb - team_start,
+                start, end);
+        for (int thr_mb = team_start + 1; thr_mb < team_end; ++thr_mb)
+            accumulate_diff_weights(ti, partial(team_start), partial(thr_mb),
+                    start, end);
+
+        simple_barrier::barrier(&reduction_bctx_, nthr_);
+    }
 
     int start{0}, end{0};
     balance211(work, nthr_mb_, ti->ithr_mb, start, end);
-    if (start == end) return;
-
-    for (int thr_mb = 1; thr_mb < nthr_mb_; ++thr_mb) {
-        int w = start;
-        int sub_g_start{0}, sub_oc_b_start{0}, sub_ic_b_kh_start{0};
-        nd_iterator_init(w, sub_g_start, ti->g_work, sub_oc_b_start,
-                ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
-        while (w < end) {
-            const int g = ti->g_start + sub_g_start;
-            const int oc_b = ti->oc_b_start + sub_oc_b_start;
-            const int ic_b = ti->ic_b_start + sub_ic_b_kh_start / jcp.kd;
-            const int kd = sub_ic_b_kh_start % jcp.kd;
-
-            const int acc_size
-                = nstl::min(end - w, ic_b_kh_work - sub_ic_b_kh_start)
-                * jcp.kw * jcp.ic_block * jcp.oc_block * jcp.kh;
-
-            const size_t off
-                = wht_blk_off(diff_weights_d, g, oc_b, ic_b, kd);
-            diff_weights_data_t *d
-                = (diff_weights_data_t *)ti->diff_weights + off;
-            diff_weights_data_t *s
-                = ws_reduction_ + (thr_mb - 1) * wei_size + off;
-            acc_ker_->accumulate(d, s, acc_size);
-
-            nd_iterator_jump(w, end, sub_g_start, ti->g_work, sub_oc_b_start,
-                    ti->oc_b_work, sub_ic_b_kh_start, ic_b_kh_work);
+    for (int team = 1; team < nthr_mb_teams_; ++team) {
+        int team_start{0}, team_end{0};
+        balance211(nthr_mb_, nthr_mb_teams_, team, team_start, team_end);
+        accumulate_diff_weights(ti, partial(0), partial(team_start), start,
+                end);
+    }
+    if (nthr_mb_teams_ == 1) {
+        for (int thr_mb = 1; thr_mb < nthr_mb_; ++thr_mb)
+            accumulate_diff_weights(ti, partial(0), partial(thr_mb), start,
+                    end);
+    }
+
+    if (jcp.with_bias && jcp.is_1stconv && jcp.ver == ver_4fma
+            && ti->ithr == 0) {
+        const diff_weights_data_t *diff_bias_ws
+            = ws_reduction_ + (nthr_mb_ - 1) * wei_size;
+        for (int thr_mb = 1; thr_mb < nthr_mb_; ++thr_mb) {
+            acc_ker_->accumulate((diff_weights_data_t *)ti->diff_bias,
+                diff_bias_ws, bia_size);
+            diff_bias_ws += bia_size;
         }
     }
 }
@@ -1516,7 +1518,7 @@ void jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
             if (conf_.with_bias()) compute_diff_bias(&thread_info);
         } else if (conf_.ndims() == 5) {
             compute_diff_weights_3d(&thread_info);
-            if (nthr_mb_ > 1) reduce_diff_weights_3d(&thread_info);
+            if (nthr_mb_ > 1) reduce_diff_weights(&thread_info);
             if (conf_.with_bias()) compute_diff_bias_3d(&thread_info);
         } else {
             assert(false);
@@ -1540,6 +1542,7 @@ void jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
     const auto &j = conf_.jcp_;
 
     nthr_ = nthr_mb_ = nthr_g_ = nthr_oc_b_ = nthr_ic_b_ = 1;
+    nthr_mb_teams_ = 1;
 
     if (max_threads < j.ngroups) {
         /* simplification... fortunately it doesn't hurt much */
@@ -1658,7 +1661,14 @@ void jit_avx512_common_convolution_bwd_weights_t<src_type, diff_dst_type,
         nthr_mb_ = min(j.mb * j.od, max_threads);
     nthr_ = nthr_mb_ * nthr_g_ * nthr_oc_b_ * nthr_ic_b_;
     assert(nthr_ <= max_threads);
+
     assert(utils::implication(!mkldnn_thr_syncable(), nthr_mb_ == 1));
+
+    /* the minibatch threads are the outermost ones, so with the thread teams
+     * bound to NUMA nodes they split into one team per node */
+    const int nnodes = mkldnn_numa() ? numa_nodes() : 1;
+    if (nnodes > 1 && nthr_mb_ >= 2 * nnodes)
+        nthr_mb_teams_ = nnodes;
 }
 
 template struct jit_avx512_common_convolution_bwd_weights_t<data_type::f32>;
@@ -351,8 +351,10 @@ private:
     struct thread_info_t;
     void compute_diff_weights(const thread_info_t *);
     void compute_diff_weights_3d(const thread_info_t *);
+    void accumulate_diff_weights(const thread_info_t *,
+            diff_weights_data_t *dst, const diff_weights_data_t *src,
+            int start, int end);
     void reduce_diff_weights(const thread_info_t *);
-    void reduce_diff_weights_3d(const thread_info_t *);
     void compute_diff_bias(const thread_info_t *);
     void compute_diff_bias_3d(const thread_info_t *);
 
@@ -370,6 +372,7 @@ private:
     diff_weights_data_t *ws_reduction_;
 
     int nthr_, nthr_mb_, nthr_g_, nthr_oc_b_, nthr_ic_b_;
+    int nthr_mb_teams_; /** groups of nthr_mb_ reducing locally first */
     simple_barrier::ctx_t *tr_src_bctx_, *tr_diff_dst_bctx_, reduction_bctx_;
 };
 
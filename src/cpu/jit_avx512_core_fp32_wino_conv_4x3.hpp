@@ -35,7 +35,16 @@ struct winograd_scratchpad_avx512_core_t {
         winograd_scratchpad_avx512_core_t(const jit_conv_winograd_conf_t &jcp)
         {
             get_scratchpad_size_(jcp);
-            allocate_scratchpad_(jcp);
+            set_offsets_();
+            scratchpad_ = create_scratchpad(scratchpad_sz_);
+        }
+
+        /* size of the buffer without allocating it */
+        static size_t size(const jit_conv_winograd_conf_t &jcp) {
+            winograd_scratchpad_avx512_core_t s;
+            s.get_scratchpad_size_(jcp);
+            s.set_offsets_();
+            return s.scratchpad_sz_;
         }
 
         ~winograd_scratchpad_avx512_core_t() {
@@ -116,7 +125,9 @@ struct winograd_scratchpad_avx512_core_t {
             }
         }
 
-        inline void allocate_scratchpad_(const jit_conv_winograd_conf_t &jcp) {
+        winograd_scratchpad_avx512_core_t(): scratchpad_(nullptr) {}
+
+        inline void set_offsets_() {
             const size_t page_size = PAGE_2M;
             U_offset_ = 0;
             V_offset_ = utils::rnd_up(U_sz_, page_size);
@@ -126,7 +137,6 @@ struct winograd_scratchpad_avx512_core_t {
                 bias_offset_ = M_offset_ + utils::rnd_up(M_sz_, page_size);
                 scratchpad_sz_ = bias_offset_ + bias_sz_;
             }
-            scratchpad_ = create_scratchpad(scratchpad_sz_);
         }
 
         scratchpad_t *scratchpad_;
@@ -223,6 +233,9 @@ struct _jit_avx512_core_fp32_wino_conv_4x3_fwd_t
 
         jit_conv_winograd_conf_t jcp_;
 
+        virtual size_t scratchpad_size() const override
+        { return winograd::winograd_scratchpad_avx512_core_t::size(jcp_); }
+
     protected:
         virtual status_t set_default_params() override
         {
@@ -317,6 +330,9 @@ struct jit_avx512_core_fp32_wino_conv_4x3_bwd_data_t
 
         jit_conv_winograd_conf_t jcp_;
 
+        virtual size_t scratchpad_size() const override
+        { return winograd::winograd_scratchpad_avx512_core_t::size(jcp_); }
+
     protected:
         virtual status_t set_default_params() override
         {
@@ -410,6 +426,9 @@ struct jit_avx512_core_fp32_wino_conv_4x3_bwd_weights_t
 
         jit_conv_winograd_conf_t jcp_;
 
+        virtual size_t scratchpad_size() const override
+        { return winograd::winograd_scratchpad_avx512_core_t::size(jcp_); }
+
     protected:
         virtual status_t set_default_params() override
         {
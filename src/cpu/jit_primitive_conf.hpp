@@ -79,6 +79,7 @@ struct jit_conv_conf_t {
     bool is_1stconv;
     /* fma avx512_core */
     conv_kernel_kind_t kernel_kind;
+    int mb_block; /* images per register tile, fwd only */
     /* 4fma */
     int tr_iw;
     int tr_src_num_guard_elems;
@@ -377,6 +378,7 @@ struct jit_gemm_conv_conf_t {
     int ic_block, oc_block;
 
     int nthr;
+    int os_block; /* output pixels of an f32 im2col tile */
     ptrdiff_t im2col_sz;
     bool need_wei_reduction;
 };
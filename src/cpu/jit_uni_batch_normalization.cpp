@@ -56,6 +56,7 @@ struct jit_bnorm_t: public jit_generator {
         const data_t *src, *dst;
         const data_t *diff_src, *diff_dst;
         const data_t *rbuf1, *rbuf2;
+        const data_t *shift;
         const uint8_t *ws;
         barrier::ctx_t *barrier;
     };
@@ -109,6 +110,7 @@ struct jit_bnorm_t: public jit_generator {
 
     // Relu section
     bool with_relu, with_relu_inf_only;
+    bool with_sum;
     Vmm vzero; // is_fwd() ? vdiff_beta : vbeta
     Reg64 reg_ws = reg_roff;
     Label l_relu_mask_avx2;
@@ -150,7 +152,8 @@ struct jit_bnorm_t: public jit_generator {
         stack_off_s_s = 80,
         stack_off_s_tail = 88,
         stack_off_is_cblk_tail = 96,
-        stack_size_required = 104,
+        stack_off_shift = 104,
+        stack_size_required = 112,
     };
 
     bool is_c_padded() const {
@@ -174,7 +177,7 @@ struct jit_bnorm_t: public jit_generator {
     void load_common_params() {
 #       define PARAM_OFF(x) offsetof(call_params_t, x)
         mov(reg_rbuf1, ptr[reg_param + PARAM_OFF(rbuf1)]);
-        if (bdesc_->is_bwd())
+        if (bdesc_->is_bwd() || !bdesc_->stats_is_src())
             mov(reg_rbuf2, ptr[reg_param + PARAM_OFF(rbuf2)]);
         mov(reg_coff_max, ptr[reg_param + PARAM_OFF(coff_max)]);
         mov(reg_soff_max, ptr[reg_param + PARAM_OFF(soff_max)]);
@@ -220,6 +223,10 @@ struct jit_bnorm_t: public jit_generator {
         }
 
         if (bdesc_->is_fwd()) {
+            if (!bdesc_->stats_is_src()) {
+                mov(reg_tmp, ptr[reg_param + PARAM_OFF(shift)]);
+                mov(ptr[rsp + stack_off_shift], reg_tmp);
+            }
             mov(reg_tmp, ptr[reg_param + PARAM_OFF(var)]);
             mov(reg_var, reg_tmp);
         } else {
@@ -255,6 +262,7 @@ struct jit_bnorm_t: public jit_generator {
     }
 
     void prepare_relu() {
+        with_sum = bdesc_->is_fwd() && bdesc_->with_sum_post_op();
         with_relu = bdesc_->is_fwd()
             ? bdesc_->with_relu_post_op() || bdesc_->fuse_bn_relu()
             : bdesc_->fuse_bn_relu();
@@ -432,68 +440,36 @@ struct jit_bnorm_t: public jit_generator {
             fini(i);
     }
 
-    void mean_channels() {
-        Label ch_label;
-        L(ch_label); {
-            uni_vmovups(Vmm(0), vmmword[reg_rbuf1 + reg_coff]);
-            spat_loop(spat_size, unroll_blocks,
-                unroll_regs,
-                    [=](size_t base_reg) {
-                        Vmm v = Vmm(base_reg * 2);
-                        if (base_reg)
-                            uni_vpxor(v, v, v);
-                    },
-                    [=](size_t base_reg, size_t i) {
-                        Vmm v0 = Vmm(base_reg * 2 + 0);
-                        Vmm v1 = Vmm(base_reg * 2 + 1);
-                        size_t offt = i * vlen;
-                        uni_vmovups(v1,
-                            vmmword[reg_src + reg_soff + offt]);
-                        uni_vaddps(v0, v0, v1);
-                        mic_prefetcht0(ptr[reg_src + reg_soff + offt
-                                + t0_pf_offt]);
-                        mic_prefetcht1(ptr[reg_src + reg_soff + offt
-                                + t1_pf_offt]);
-                    },
-                    [=](size_t base_reg) {
-                        Vmm b = Vmm(0);
-                        Vmm v = Vmm(base_reg * 2);
-                        if (base_reg)
-                            uni_vaddps(b, b, v);
-                    });
-            uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
-
-            add(reg_coff, vlen);
-            cmp(reg_coff, reg_coff_max);
-            jl(ch_label);
-        }
-    }
-
-    void var_channels() {
+    /* One pass over the data for the statistics: the sums of x - shift and
+     * of its squares, with the shift being the first point of the channel,
+     * so that the variance does not lose the precision when the mean is
+     * large compared to the deviation. */
+    void stats_channels() {
         Label ch_label;
         L(ch_label); {
-            uni_vmovups_maybe_tail(vmean, mean_ptr());
+            mov(reg_tmp, ptr[rsp + stack_off_shift]);
+            uni_vmovups(vmean, vmmword[reg_tmp + reg_coff]);
             uni_vmovups(Vmm(0), vmmword[reg_rbuf1 + reg_coff]);
+            uni_vmovups(Vmm(1), vmmword[reg_rbuf2 + reg_coff]);
             spat_loop(spat_size, unroll_blocks, unroll_regs,
                     [=](size_t base_reg) {
-                        Vmm v = Vmm(base_reg * 3);
-                        if (base_reg > 0)
-                            uni_vpxor(v, v, v);
+                        Vmm v0 = Vmm(base_reg * 3 + 0);
+                        Vmm v1 = Vmm(base_reg * 3 + 1);
+                        if (base_reg) {
+                            uni_vpxor(v0, v0, v0);
+                            uni_vpxor(v1, v1, v1);
+                        }
                     },
                     [=](size_t base_reg, size_t i) {
-                        Vmm v = Vmm(3 * base_reg);
-                        Vmm vtmp0 = Vmm(3 * base_reg + 1);
-                        Vmm vtmp1 = Vmm(3 * base_reg + 2);
+                        Vmm v0 = Vmm(base_reg * 3 + 0);
+                        Vmm v1 = Vmm(base_reg * 3 + 1);
+                        Vmm vtmp = Vmm(base_reg * 3 + 2);
                         size_t offt = i * vlen;
-                        uni_vmovups(vtmp0,
+                        uni_vmovups(vtmp,
                             vmmword[reg_src + reg_soff + offt]);
-                        if (isa == sse42) {
-                            movups(vtmp1, vmean);
-                            subps(vtmp1, vtmp0);
-                        } else {
-                            vsubps(vtmp1, vmean, vtmp0);
-                        }
-                        uni_vfmadd231ps(v, vtmp1, vtmp1);
+                        uni_vsubps(vtmp, vtmp, vmean);
+                        uni_vaddps(v0, v0, vtmp);
+                        uni_vfmadd231ps(v1, vtmp, vtmp);
 
                         mic_prefetcht0(ptr[reg_src + reg_soff + offt
                                 + t0_pf_offt]);
@@ -501,12 +477,14 @@ struct jit_bnorm_t: public jit_generator {
                                 + t1_pf_offt]);
                     },
                     [=](size_t base_reg) {
-                        Vmm b = Vmm(0);
-                        Vmm v = Vmm(base_reg * 3);
-                        if (base_reg)
-                            uni_vaddps(b, b, v);
+                        if (base_reg) {
+                            uni_vaddps(Vmm(0), Vmm(0), Vmm(base_reg * 3 + 0));
+                            uni_vaddps(Vmm(1), Vmm(1), Vmm(base_reg * 3 + 1));
+                        }
                     });
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            uni_vmovups(vmmword[reg_rbuf2 + reg_coff], Vmm(1));
+
             add(reg_coff, vlen);
             cmp(reg_coff, reg_coff_max);
             jl(ch_label);
@@ -519,6 +497,7 @@ struct jit_bnorm_t: public jit_generator {
         Label zero_rbuf;
         L(zero_rbuf); {
             uni_vmovups(vmmword[reg_rbuf1 + reg_coff], Vmm(0));
+            uni_vmovups(vmmword[reg_rbuf2 + reg_coff], Vmm(0));
             add(reg_coff, isa == sse42 ? vlen / 2 : vlen);
             cmp(reg_coff, reg_coff_max);
             jne(zero_rbuf);
@@ -527,117 +506,72 @@ struct jit_bnorm_t: public jit_generator {
         mov(reg_src, ptr[rsp + stack_off_src]);
 
         xor_(reg_soff, reg_soff);
-        Label mean_spatial;
-        L(mean_spatial); {
+        Label stats_spatial;
+        L(stats_spatial); {
             xor_(reg_coff, reg_coff);
 
             if (isa == sse42)
                 mov(reg_tmp_off, reg_soff);
 
-            mean_channels();
+            stats_channels();
 
             if (isa == sse42) {
                 mov(reg_soff, reg_tmp_off);
                 add(reg_src, vlen / 2);
                 mov(reg_coff, vlen / 2);
 
-                mean_channels();
+                stats_channels();
 
                 sub(reg_src, vlen / 2);
             }
 
             add(reg_soff, reg_mb_stride_Bc);
             cmp(reg_soff, reg_soff_max);
-            jne(mean_spatial);
+            jne(stats_spatial);
         }
 
-        Label no_mean_reduction;
+        Label no_stats_reduction;
         barrier(); {
             mov(reg_tmp, ptr[rsp + stack_off_N_ithr]);
             cmp(reg_tmp, 0);
-            jne(no_mean_reduction);
+            jne(no_stats_reduction);
             mov(reg_nnthr, ptr[rsp + stack_off_N_nthr]);
+            /* reg_src is reloaded by forward() */
+            mov(reg_src, ptr[rsp + stack_off_shift]);
             xor_(reg_coff, reg_coff);
-            Label mean_reduction_channels;
-            L(mean_reduction_channels); {
+            Label stats_reduction_channels;
+            L(stats_reduction_channels); {
                 mov(reg_roff, reg_coff);
                 uni_vpxor(Vmm(0), Vmm(0), Vmm(0));
                 uni_vpxor(Vmm(1), Vmm(1), Vmm(1));
                 mov(reg_ctr, reg_nnthr);
-                Label mean_reduction_thrs;
-                L(mean_reduction_thrs); {
-                    uni_vaddps(Vmm(1), Vmm(1), vmmword[reg_rbuf1 + reg_roff]);
-                    uni_vmovups(vmmword[reg_rbuf1 + reg_roff], Vmm(0));
-                    add(reg_roff, reg_coff_max);
-                    sub(reg_ctr, 1);
-                    jnz(mean_reduction_thrs);
-                }
-                uni_vdivps(Vmm(1), Vmm(1), vchan_size);
-                uni_vmovups_maybe_tail(mean_ptr(), Vmm(1));
-
-                add(reg_coff, isa == sse42 ? vlen / 2 : vlen);
-
-                cmp(reg_coff, reg_coff_max);
-                jne(mean_reduction_channels);
-            }
-        }
-        L(no_mean_reduction);
-        barrier();
-
-        xor_(reg_soff, reg_soff);
-        Label var_spatial;
-        L(var_spatial); {
-            xor_(reg_coff, reg_coff);
-
-            if (isa == sse42)
-                mov(reg_tmp_off, reg_soff);
-
-            var_channels();
-
-            if (isa == sse42) {
-                mov(reg_soff, reg_tmp_off);
-                add(reg_src, vlen / 2);
-                mov(reg_coff, vlen / 2);
-
-                var_channels();
-
-                sub(reg_src, vlen / 2);
-            }
-
-            add(reg_soff, reg_mb_stride_Bc);
-            cmp(reg_soff, reg_soff_max);
-            jne(var_spatial);
-        }
-
-        Label no_var_reduction;
-        barrier(); {
-            mov(reg_tmp, ptr[rsp + stack_off_N_ithr]);
-            cmp(reg_tmp, 0);
-            jne(no_var_reduction);
-
-            mov(reg_nnthr, ptr[rsp + stack_off_N_nthr]);
-            xor_(reg_coff, reg_coff);
-            Label var_reduction_channels;
-            L(var_reduction_channels); {
-                mov(reg_roff, reg_coff);
-                uni_vpxor(Vmm(1), Vmm(1), Vmm(1));
-                mov(reg_ctr, reg_nnthr);
-                Label var_reduction_thrs;
-                L(var_reduction_thrs); { // TODO: unroll (?)
-                    uni_vaddps(Vmm(1), Vmm(1), vmmword[reg_rbuf1 + reg_roff]);
+                Label stats_reduction_thrs;
+                L(stats_reduction_thrs); {
+                    uni_vaddps(Vmm(0), Vmm(0), vmmword[reg_rbuf1 + reg_roff]);
+                    uni_vaddps(Vmm(1), Vmm(1), vmmword[reg_rbuf2 + reg_roff]);
                     add(reg_roff, reg_coff_max);
                     sub(reg_ctr, 1);
-                    jnz(var_reduction_thrs);
+                    jnz(stats_reduction_thrs);
                 }
+                /* mean = shift + E[x - shift],
+                 * var = E[(x - shift)^2] - E[x - shift]^2 */
+                uni_vdivps(Vmm(0), Vmm(0), vchan_size);
                 uni_vdivps(Vmm(1), Vmm(1), vchan_size);
+                uni_vmovups(Vmm(2), vmmword[reg_src + reg_coff]);
+                uni_vaddps(Vmm(2), Vmm(2), Vmm(0));
+                uni_vmovups_maybe_tail(mean_ptr(), Vmm(2));
+                uni_vfnmadd231ps(Vmm(1), Vmm(0), Vmm(0));
+                uni_vpxor(Vmm(2), Vmm(2), Vmm(2));
+                uni_vmaxps(Vmm(1), Vmm(1), Vmm(2));
                 uni_vmovups_maybe_tail(var_ptr(), Vmm(1));
+
                 add(reg_coff, isa == sse42 ? vlen / 2 : vlen);
 
                 cmp(reg_coff, reg_coff_max);
-                jne(var_reduction_channels);
+                jne(stats_reduction_channels);
             }
         }
-        L(no_var_reduction);
+        L(no_stats_reduction);
         barrier();
     }
 
@@ -679,6 +613,12 @@ struct jit_bnorm_t: public jit_generator {
                              if (bdesc_->use_scaleshift()) {
                                  uni_vfmadd213ps(v, vgamma, vbeta);
                              }
+                             if (with_sum) {
+                                 Vmm vres = Vmm(unroll_regs + base_reg);
+                                 uni_vmovups(vres,
+                                     vmmword[reg_dst + reg_soff + offt]);
+                                 uni_vaddps(v, v, vres);
+                             }
                              if (with_relu_inf_only) {
                                  uni_vmaxps(v, v, vzero);
                              } else if (with_relu) {
@@ -1053,19 +993,23 @@ struct uni_bnorm_driver_t: public c_compatible {
         use_tmp_diff_scale_shift_ = false
             || (bdesc_->is_bwd() && !bdesc_->use_scaleshift())
             || bdesc_->desc()->prop_kind == prop_kind::backward_data;
+        compute_stats_ = bdesc_->is_fwd() && !bdesc_->stats_is_src();
         int num_sbufs = 2 * use_tmp_stats_;
         int num_pbufs = 2 * use_tmp_diff_scale_shift_;
-        int num_rbufs = bdesc_->is_fwd() ? 1 : 2;
+        int num_rbufs = bdesc_->is_fwd() && !compute_stats_ ? 1 : 2;
+        int num_shbufs = compute_stats_;
         int nthrs = mkldnn_get_max_threads();
         int C_PADDED = memory_desc_wrapper(bdesc_->src_pd()).blocking_desc()
             .padding_dims[1];
 
-        int buf_size = (num_sbufs + num_pbufs + num_rbufs * nthrs) * C_PADDED;
+        int buf_size = (num_sbufs + num_pbufs
+                + (num_rbufs + num_shbufs) * nthrs) * C_PADDED;
         buf_ = (data_t *)malloc(buf_size * sizeof(data_t), 64);
 
         sbuf_ = buf_;
         pbuf_ = sbuf_ + num_sbufs * C_PADDED;
         rbuf_ = pbuf_ + num_pbufs * C_PADDED;
+        shbuf_ = rbuf_ + num_rbufs * nthrs * C_PADDED;
 
         int num_barriers = C_PADDED / simd_w;
         if (mkldnn_thr_syncable()) {
@@ -1192,8 +1136,19 @@ struct uni_bnorm_driver_t: public c_compatible {
             size_t iter_bariers
                     = do_blocking_ ? it * global_barriers_per_iter : 0;
             p.barrier = barriers_ + C_ithr + iter_bariers;
-            if (p.soff_max != 0 && p.coff_max != 0)
+            if (p.soff_max != 0 && p.coff_max != 0) {
+                if (compute_stats_) {
+                    /* the shifts of the statistics: the first point of the
+                     * channels, the same for all the threads of a channel */
+                    data_t *shift = shbuf_ + ithr * C_PADDED;
+                    for (int cb = 0; cb < C_blks_thr; ++cb)
+                    for (int c = 0; c < simd_w; ++c)
+                        shift[cb * simd_w + c] = src[(global_C_blk_s + cb)
+                            * p.spat_size * simd_w + c];
+                    p.shift = shift;
+                }
                 ker_(&p);
+            }
         }
     }
 
@@ -1204,10 +1159,11 @@ private:
     const batch_normalization_pd_t *bdesc_;
     jit_bnorm_t<isa> ker_;
     bool use_tmp_stats_, use_tmp_diff_scale_shift_;
+    bool compute_stats_;
     bool do_blocking_;
     size_t l3_size_;
 
-    data_t *buf_, *sbuf_, *rbuf_, *pbuf_;
+    data_t *buf_, *sbuf_, *rbuf_, *pbuf_, *shbuf_;
 
     barrier::ctx_t *barriers_;
 };
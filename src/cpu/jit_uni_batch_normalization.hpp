@@ -63,7 +63,8 @@ struct jit_uni_batch_normalization_fwd_t: public cpu_primitive_t {
                 && utils::implication(use_scaleshift(),
                         desc()->data_scaleshift_desc.data_type == f32)
                 && desc()->data_desc.format == desired_fmt
-                && (attr()->has_default_values() || this->with_relu_post_op());
+                && (attr()->has_default_values() || this->with_relu_post_op()
+                        || this->with_sum_post_op());
             if (!ok) return status::unimplemented;
 
             if (is_training() && fuse_bn_relu()) {
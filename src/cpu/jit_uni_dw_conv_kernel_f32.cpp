@@ -49,7 +49,7 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::load_src(int ur_ch_blocks, int ur_w) {
                 else
                     uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
 
-                int o_off = ch*jcp.oh*jcp.ow*jcp.ch_block
+                int o_off = ch*jcp.od*jcp.oh*jcp.ow*jcp.ch_block
                     + ow*jcp.ch_block + i*4;
                 if (this->jcp.with_sum)
                     uni_vaddps(vmm_acc, vmm_acc,
@@ -59,6 +59,35 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::load_src(int ur_ch_blocks, int ur_w) {
     }
 }
 
+template <cpu_isa_t isa>
+void jit_uni_dw_conv_fwd_kernel_f32<isa>::kd_loop_begin(Label &kd_label,
+        Label &exit_label) {
+    if (jcp.ndims != 5) return;
+
+    cmp(reg_kd, 0);
+    je(exit_label, T_NEAR);
+
+    mov(iter_kd, reg_kd);
+    L(kd_label);
+    push(aux_reg_input);
+    push(aux_reg_kernel);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_dw_conv_fwd_kernel_f32<isa>::kd_loop_end(Label &kd_label) {
+    if (jcp.ndims != 5) return;
+
+    pop(aux_reg_kernel);
+    pop(aux_reg_input);
+    add(aux_reg_kernel, jcp.kh*jcp.kw*jcp.ch_block*sizeof(float));
+    add(aux_reg_input, jcp.ih*jcp.iw*jcp.ch_block*(jcp.dilate_d + 1)
+            *sizeof(float));
+
+    dec(iter_kd);
+    cmp(iter_kd, 0);
+    jg(kd_label, T_NEAR);
+}
+
 template <cpu_isa_t isa>
 void jit_uni_dw_conv_fwd_kernel_f32<isa>::apply_filter(
         int ur_ch_blocks, int ur_w) {
@@ -74,6 +103,9 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::apply_filter(
     cmp(reg_kw, 0);
     je(iter_exit_label, T_NEAR);
 
+    Label kd_label;
+    kd_loop_begin(kd_label, iter_exit_label);
+
     mov(iter_kh, reg_kh);
     Label kh_label;
     L(kh_label); {
@@ -86,13 +118,13 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::apply_filter(
             int repeats = isa == sse42 ? 2 : 1;
             for (int i = 0; i < repeats; i++) {
                 for (int ch = 0; ch < ur_ch_blocks; ch++) {
-                    int ker_off = ch*jcp.kh*jcp.kw*ch_blk + i*4;
+                    int ker_off = ch*jcp.kd*jcp.kh*jcp.kw*ch_blk + i*4;
                     Vmm vmm_ker = get_ker_reg(0);
                     uni_vmovups(vmm_ker, ptr[aux1_reg_kernel
                         + ker_off*sizeof(float)]);
 
                     for (int ow = 0; ow < ur_w; ow++) {
-                        int inp_off = ch*jcp.ih*jcp.iw*ch_blk
+                        int inp_off = ch*jcp.id*jcp.ih*jcp.iw*ch_blk
                             + ow*stride_w*ch_blk + i*4;
                         Vmm vmm_src = get_src_reg(0);
                         uni_vmovups(vmm_src, ptr[aux1_reg_input
@@ -119,6 +151,8 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::apply_filter(
         jg(kh_label, T_NEAR);
     }
 
+    kd_loop_end(kd_label);
+
     L(iter_exit_label);
 }
 
@@ -135,6 +169,9 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::apply_filter_unrolled(
     cmp(reg_kh, 0);
     je(iter_exit_label, T_NEAR);
 
+    Label kd_label;
+    kd_loop_begin(kd_label, iter_exit_label);
+
     mov(iter_kh, reg_kh);
     Label kh_label;
     L(kh_label); {
@@ -142,14 +179,15 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::apply_filter_unrolled(
         for (int i = 0; i < repeats; i++) {
             for (int ch = 0; ch < ur_ch_blocks; ch++) {
                 for (int kw = 0; kw < jcp.kw; kw++) {
-                    int ker_off = ch*jcp.kh*jcp.kw*ch_blk + kw*ch_blk + i*4;
+                    int ker_off = ch*jcp.kd*jcp.kh*jcp.kw*ch_blk
+                        + kw*ch_blk + i*4;
 
                     Vmm vmm_ker = get_ker_reg(0);
                     uni_vmovups(vmm_ker, ptr[aux_reg_kernel
                         + ker_off*sizeof(float)]);
 
                     for (int ow = 0; ow < ur_w; ow++) {
-                        int inp_off = ch*jcp.ih*jcp.iw*ch_blk
+                        int inp_off = ch*jcp.id*jcp.ih*jcp.iw*ch_blk
                             + ow*stride_w*ch_blk + kw*ch_blk*dilate_w + i*4;
 
                         Vmm vmm_src = get_src_reg(0);
@@ -172,6 +210,8 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::apply_filter_unrolled(
         jg(kh_label, T_NEAR);
     }
 
+    kd_loop_end(kd_label);
+
     L(iter_exit_label);
 }
 
@@ -225,7 +265,7 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::store_dst(
     for (int i = 0; i < repeats; i++) {
         for (int ch = 0; ch < ur_ch_blocks; ch++) {
             for (int ow = 0; ow < ur_w; ow++) {
-                int o_off = ch*jcp.oh*jcp.ow*ch_blk + ow*ch_blk + i*4;
+                int o_off = ch*jcp.od*jcp.oh*jcp.ow*ch_blk + ow*ch_blk + i*4;
                 Vmm vmm_dst = get_acc_reg(i*ur_ch_blocks*ur_w + ch*ur_w + ow);
 
                 uni_vmovups(vmmword[reg_output + o_off*sizeof(float)], vmm_dst);
@@ -298,6 +338,8 @@ void jit_uni_dw_conv_fwd_kernel_f32<isa>::generate() {
     mov(reg_kw, ptr[this->param1 + GET_OFF(kw_padding)]);
     mov(reg_ch_blocks, ptr[this->param1 + GET_OFF(ch_blocks)]);
     mov(reg_ur_w, ptr[this->param1 + GET_OFF(ur_w)]);
+    if (jcp.ndims == 5)
+        mov(reg_kd, ptr[this->param1 + GET_OFF(kd_padding)]);
 
     Label ch_blocks_tail_label;
     Label exit_label;
@@ -356,6 +398,10 @@ status_t jit_uni_dw_conv_fwd_kernel_f32<isa>::init_conf(jit_conv_conf_t &jcp,
     const bool with_groups = weights_d.ndims() == src_d.ndims() + 1;
     if (!with_groups) return status::unimplemented;
 
+    const int ndims = src_d.ndims();
+    const bool is_3d = ndims == 5;
+    jcp.ndims = ndims;
+
     jcp.ngroups = weights_d.dims()[0];
     jcp.mb = src_d.dims()[0];
 
@@ -363,24 +409,31 @@ status_t jit_uni_dw_conv_fwd_kernel_f32<isa>::init_conf(jit_conv_conf_t &jcp,
     jcp.oc_without_padding = jcp.oc;
     jcp.ic = src_d.dims()[1];
 
-    jcp.ih = src_d.dims()[2];
-    jcp.iw = src_d.dims()[3];
-    jcp.oh = dst_d.dims()[2];
-    jcp.ow = dst_d.dims()[3];
+    jcp.id = is_3d ? src_d.dims()[2] : 1;
+    jcp.ih = src_d.dims()[ndims - 2];
+    jcp.iw = src_d.dims()[ndims - 1];
+    jcp.od = is_3d ? dst_d.dims()[2] : 1;
+    jcp.oh = dst_d.dims()[ndims - 2];
+    jcp.ow = dst_d.dims()[ndims - 1];
 
-    jcp.kh = weights_d.dims()[3];
-    jcp.kw = weights_d.dims()[4];
+    jcp.kd = is_3d ? weights_d.dims()[3] : 1;
+    jcp.kh = weights_d.dims()[ndims - 1];
+    jcp.kw = weights_d.dims()[ndims];
 
-    jcp.t_pad = cd.padding[0][0];
-    jcp.l_pad = cd.padding[0][1];
-    jcp.b_pad = cd.padding[1][0];
-    jcp.r_pad = cd.padding[1][1];
+    jcp.f_pad = is_3d ? cd.padding[0][0] : 0;
+    jcp.t_pad = cd.padding[0][ndims - 4];
+    jcp.l_pad = cd.padding[0][ndims - 3];
+    jcp.back_pad = is_3d ? cd.padding[1][0] : 0;
+    jcp.b_pad = cd.padding[1][ndims - 4];
+    jcp.r_pad = cd.padding[1][ndims - 3];
 
-    jcp.stride_h = cd.strides[0];
-    jcp.stride_w = cd.strides[1];
+    jcp.stride_d = is_3d ? cd.strides[0] : 1;
+    jcp.stride_h = cd.strides[ndims - 4];
+    jcp.stride_w = cd.strides[ndims - 3];
 
-    jcp.dilate_h = cd.dilates[0];
-    jcp.dilate_w = cd.dilates[1];
+    jcp.dilate_d = is_3d ? cd.dilates[0] : 0;
+    jcp.dilate_h = cd.dilates[ndims - 4];
+    jcp.dilate_w = cd.dilates[ndims - 3];
 
     jcp.src_fmt = src_d.format();
     jcp.with_bias = cd.bias_desc.format != memory_format::undef;
@@ -410,8 +463,10 @@ status_t jit_uni_dw_conv_fwd_kernel_f32<isa>::init_conf(jit_conv_conf_t &jcp,
         jcp.ngroups = rnd_up(jcp.ngroups, simd_w);
     }
 
-    auto desired_act_fmt = isa == avx512_common ? nChw16c : nChw8c;
-    auto desired_wei_fmt = isa == avx512_common ? Goihw16g : Goihw8g;
+    auto desired_act_fmt = isa == avx512_common
+        ? (is_3d ? nCdhw16c : nChw16c) : (is_3d ? nCdhw8c : nChw8c);
+    auto desired_wei_fmt = isa == avx512_common
+        ? (is_3d ? Goidhw16g : Goihw16g) : (is_3d ? Goidhw8g : Goihw8g);
 
     bool args_ok = true
         && jcp.oc == jcp.ngroups
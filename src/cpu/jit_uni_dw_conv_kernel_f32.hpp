@@ -69,12 +69,18 @@ private:
     reg64_t reg_ur_w = rbp;
     reg64_t reg_ch_blocks = aux1_reg_input;
     reg64_t imm_addr64 = aux1_reg_input;
+    /* 3D only; param1 is free once the arguments are loaded */
+    reg64_t reg_kd = abi_not_param1;
+    reg64_t iter_kd = abi_param1;
 
     inline Vmm get_ker_reg(int idx) { return Vmm(idx + 0); }
     inline Vmm get_src_reg(int idx) { return Vmm(idx + 1); }
     inline Vmm get_acc_reg(int idx) { return Vmm(idx + 4); }
 
     inline void load_src(int ur_ch_blocks, int ur_w);
+    inline void kd_loop_begin(Xbyak::Label &kd_label,
+            Xbyak::Label &exit_label);
+    inline void kd_loop_end(Xbyak::Label &kd_label);
     inline void apply_filter(int ur_ch_blocks, int ur_w);
     inline void apply_filter_unrolled(int ur_ch_blocks, int ur_w);
     inline void apply_activation(int ur_ch_blocks, int ur_w);
@@ -48,13 +48,17 @@ void _jit_uni_dw_convolution_fwd_t<isa, with_relu>::execute_forward() {
         bias = padded_bias_;
     }
 
+    const bool is_3d = jcp.ndims == 5;
+    int dil_d = jcp.dilate_d + 1;
     int dil_h = jcp.dilate_h + 1;
     int dil_w = jcp.dilate_w + 1;
+    int str_d = jcp.stride_d;
     int str_h = jcp.stride_h;
     int str_w = jcp.stride_w;
 
-    auto kernel_params = [&](int ur_w_step, int ow, int oh, int ih, int kh,
-            int kh_padding, int ch, int ch_num, int n) {
+    auto kernel_params = [&](int ur_w_step, int ow, int od, int oh, int id,
+            int ih, int kd, int kh, int kd_padding, int kh_padding, int ch,
+            int ch_num, int n) {
         auto par_conv = jit_conv_call_s();
 
         const int i_l_overflow = nstl::max(0, (jcp.l_pad - ow * str_w));
@@ -68,12 +72,18 @@ void _jit_uni_dw_convolution_fwd_t<isa, with_relu>::execute_forward() {
         const int kw_padding = jcp.kw - div_up(i_l_overflow, dil_w)
             - div_up(i_r_overflow, dil_w);
 
-        par_conv.src = &src[src_d.blk_off(n, ch, ih, iw)];
-        par_conv.dst = &dst[dst_d.blk_off(n, ch, oh, ow)];
-
-        par_conv.filt = &weights[weights_d.blk_off(ch, 0, 0, kh, kw)];
+        if (is_3d) {
+            par_conv.src = &src[src_d.blk_off(n, ch, id, ih, iw)];
+            par_conv.dst = &dst[dst_d.blk_off(n, ch, od, oh, ow)];
+            par_conv.filt = &weights[weights_d.blk_off(ch, 0, 0, kd, kh, kw)];
+        } else {
+            par_conv.src = &src[src_d.blk_off(n, ch, ih, iw)];
+            par_conv.dst = &dst[dst_d.blk_off(n, ch, oh, ow)];
+            par_conv.filt = &weights[weights_d.blk_off(ch, 0, 0, kh, kw)];
+        }
         if (bias) par_conv.bias = &bias[bias_d.blk_off(ch*jcp.ch_block)];
 
+        par_conv.kd_padding = (size_t)nstl::max(0, kd_padding);
         par_conv.kh_padding = (size_t)nstl::max(0, kh_padding);
         par_conv.kw_padding = (size_t)nstl::max(0, kw_padding);
 
@@ -85,11 +95,21 @@ void _jit_uni_dw_convolution_fwd_t<isa, with_relu>::execute_forward() {
     };
 
     const int chb_work = utils::div_up(jcp.nb_ch, jcp.nb_ch_blocking);
-    parallel_nd(jcp.mb, chb_work, jcp.oh,
-            [&](int n, int chb, int oh) {
+    parallel_nd(jcp.mb, chb_work, jcp.od, jcp.oh,
+            [&](int n, int chb, int od, int oh) {
         int ch = chb * jcp.nb_ch_blocking;
         int ch_num = jcp.nb_ch_blocking;
 
+        const int i_f_overflow = nstl::max(0, (int)(jcp.f_pad - od*str_d));
+        const int i_back_overflow = nstl::max(jcp.id,
+            (int)(od*str_d + (jcp.kd - 1)*dil_d - jcp.f_pad + 1)) - jcp.id;
+
+        const int id = nstl::max((int)(od*str_d - jcp.f_pad
+            + div_up(i_f_overflow, dil_d)*dil_d), 0);
+        const int kd = div_up(i_f_overflow, dil_d);
+        const int kd_padding = jcp.kd - div_up(i_f_overflow, dil_d)
+            - div_up(i_back_overflow, dil_d);
+
         const int i_t_overflow = nstl::max(0, (int)(jcp.t_pad - oh*str_h));
         const int i_b_overflow = nstl::max(jcp.ih,
             (int)(oh*str_h + (jcp.kh - 1)*dil_h - jcp.t_pad + 1)) - jcp.ih;
@@ -105,8 +125,8 @@ void _jit_uni_dw_convolution_fwd_t<isa, with_relu>::execute_forward() {
         int l_border = nstl::min(div_up(jcp.l_pad, str_w), jcp.ow);
         int ur_w_step = 1;
         for (; ow < l_border; ow++) {
-            jit_conv_call_s par_conv = kernel_params(ur_w_step, ow, oh, ih,
-                                        kh, kh_padding, ch, ch_num, n);
+            jit_conv_call_s par_conv = kernel_params(ur_w_step, ow, od, oh,
+                    id, ih, kd, kh, kd_padding, kh_padding, ch, ch_num, n);
 
             kernel_->jit_ker(&par_conv);
         }
@@ -115,8 +135,8 @@ void _jit_uni_dw_convolution_fwd_t<isa, with_relu>::execute_forward() {
         ur_w_step = (jcp.iw - (jcp.kw - 1)*dil_w + jcp.l_pad - 1)
             / jcp.stride_w - ow + 1;
         if (ur_w_step > 0) {
-            jit_conv_call_s par_conv = kernel_params(ur_w_step, ow, oh, ih,
-                                        kh, kh_padding, ch, ch_num, n);
+            jit_conv_call_s par_conv = kernel_params(ur_w_step, ow, od, oh,
+                    id, ih, kd, kh, kd_padding, kh_padding, ch, ch_num, n);
 
             kernel_->jit_ker(&par_conv);
 
@@ -126,8 +146,8 @@ void _jit_uni_dw_convolution_fwd_t<isa, with_relu>::execute_forward() {
         // right border
         ur_w_step = 1;
         for (; ow < jcp.ow; ow++) {
-            jit_conv_call_s par_conv = kernel_params(ur_w_step, ow, oh, ih,
-                                        kh, kh_padding, ch, ch_num, n);
+            jit_conv_call_s par_conv = kernel_params(ur_w_step, ow, od, oh,
+                    id, ih, kd, kh, kd_padding, kh_padding, ch, ch_num, n);
 
             kernel_->jit_ker(&par_conv);
         }
@@ -73,8 +73,12 @@ struct _jit_uni_dw_convolution_fwd_t: public cpu_primitive_t {
     protected:
         virtual status_t set_default_params() override {
             using namespace memory_format;
-            auto desired_act_fmt = isa == avx512_common ? nChw16c : nChw8c;
-            auto desired_wei_fmt = isa == avx512_common ? Goihw16g : Goihw8g;
+            const bool is_3d = this->cdesc_().src_desc.ndims == 5;
+            auto desired_act_fmt = isa == avx512_common
+                ? (is_3d ? nCdhw16c : nChw16c) : (is_3d ? nCdhw8c : nChw8c);
+            auto desired_wei_fmt = isa == avx512_common
+                ? (is_3d ? Goidhw16g : Goihw16g)
+                : (is_3d ? Goidhw8g : Goihw8g);
 
             if (this->src_pd_.desc()->format == any)
                 CHECK(this->src_pd_.set_format(desired_act_fmt));
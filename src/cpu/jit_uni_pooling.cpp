@@ -64,7 +64,8 @@ void jit_uni_pooling_fwd_t<isa>::execute_forward() {
         (*kernel_)(&arg);
     };
 
-    parallel_nd(jpp.mb, jpp.nb_c, jpp.oh,
+    /* the rows at the padding borders take less time */
+    parallel_nd_dynamic(jpp.mb, jpp.nb_c, jpp.oh,
         [&](int n, int b_c, int oh) {
         ker(n, b_c, oh);
     });
@@ -116,7 +117,7 @@ void jit_uni_pooling_fwd_t<isa>::execute_forward_3d() {
         (*kernel_)(&arg);
     };
 
-    parallel_nd(jpp.mb, jpp.nb_c, jpp.od,
+    parallel_nd_dynamic(jpp.mb, jpp.nb_c, jpp.od,
         [&](int n, int b_c, int od) {
         const int ik = od * jpp.stride_d;
         const int d_t_overflow = nstl::max(0, jpp.f_pad-ik);
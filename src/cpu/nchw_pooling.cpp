@@ -139,8 +139,9 @@ void nchw_pooling_fwd_t<data_type>::execute_forward() {
     };
 
 
+    /* the kernels are cheaper at the padding borders */
     if (conf_.desc()->alg_kind == pooling_max) {
-        parallel_nd(MB, C, OD, OH, OW,
+        parallel_nd_dynamic(MB, C, OD, OH, OW,
             [&](int mb, int c, int od, int oh, int ow) {
             size_t dst_offset
                 = (size_t)OW * OH * OD * C * mb
@@ -154,7 +155,7 @@ void nchw_pooling_fwd_t<data_type>::execute_forward() {
             ker_max(d, mb, c, od, oh, ow);
         });
     } else {
-        parallel_nd(MB, C, OD, OH, OW,
+        parallel_nd_dynamic(MB, C, OD, OH, OW,
             [&](int mb, int c, int od, int oh, int ow) {
             size_t dst_offset
                 = (size_t)OW * OH * OD * C * mb
@@ -53,7 +53,8 @@ struct nspc_batch_normalization_fwd_t : public cpu_primitive_t {
                 && utils::implication(use_scaleshift(),
                         desc()->data_scaleshift_desc.data_type == f32)
                 && utils::one_of(data_pd_.desc()->format, memory_format::nhwc)
-                && (attr()->has_default_values() || this->with_relu_post_op());
+                && (attr()->has_default_values() || this->with_relu_post_op())
+                && !this->with_sum_post_op();
             if (!ok)
                 return status::unimplemented;
 
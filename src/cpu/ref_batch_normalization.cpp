@@ -72,6 +72,7 @@ void ref_batch_normalization_fwd_t<data_type>::execute_forward() {
     const bool fuse_bn_relu = conf_.fuse_bn_relu();
     const bool calculate_stats = !conf_.stats_is_src();
 
+    const bool with_sum = conf_.with_sum_post_op();
     const bool with_relu = conf_.with_relu_post_op();
     auto maybe_post_op = [&](data_t res) {
         return (with_relu && res < 0) ? 0 : res;
@@ -121,6 +122,7 @@ void ref_batch_normalization_fwd_t<data_type>::execute_forward() {
         for (int w = 0; w < W; ++w) {
             auto d_off = data_offset(data_d,n,c,d,h,w);
             data_t bn_res = sm * (src[d_off] - v_mean) * sqrt_variance + sv;
+            if (with_sum) bn_res += dst[d_off];
             if (fuse_bn_relu) {
                 if (bn_res <= 0) {
                     bn_res = 0;
@@ -48,7 +48,8 @@ struct ref_batch_normalization_fwd_t: public cpu_primitive_t {
                         forward_inference)
                 && utils::everyone_is(data_type, desc()->data_desc.data_type,
                         desc()->data_scaleshift_desc.data_type)
-                && (attr()->has_default_values() || this->with_relu_post_op());
+                && (attr()->has_default_values() || this->with_relu_post_op()
+                        || this->with_sum_post_op());
             if (!ok) return status::unimplemented;
 
             if (stats_is_src() || is_training()) {
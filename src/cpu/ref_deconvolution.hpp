@@ -204,6 +204,13 @@ struct ref_deconvolution_fwd_t: public cpu_primitive_t {
             }
             else return status::unimplemented;
         }
+
+        /* the work is done by the convolution */
+        virtual double efficiency() const override
+        { return conv_pd_->efficiency(); }
+        virtual size_t scratchpad_size() const override
+        { return conv_pd_->scratchpad_size(); }
+
         primitive_desc_t *conv_pd_;
         bool conv_supports_bias_;
     };
@@ -317,6 +324,13 @@ struct ref_deconvolution_bwd_data_t: public cpu_primitive_t {
             }
             else return status::unimplemented;
         }
+
+        /* the work is done by the convolution */
+        virtual double efficiency() const override
+        { return conv_pd_->efficiency(); }
+        virtual size_t scratchpad_size() const override
+        { return conv_pd_->scratchpad_size(); }
+
         primitive_desc_t *conv_pd_;
     };
     ref_deconvolution_bwd_data_t(const pd_t *pd, const input_vector &inputs,
@@ -406,6 +420,13 @@ struct ref_deconvolution_bwd_weights_t: public cpu_primitive_t {
             }
             else return status::unimplemented;
         }
+
+        /* the work is done by the convolution */
+        virtual double efficiency() const override
+        { return conv_pd_->efficiency(); }
+        virtual size_t scratchpad_size() const override
+        { return conv_pd_->scratchpad_size(); }
+
         primitive_desc_t *conv_pd_;
     };
 
@@ -53,7 +53,8 @@ void ref_lrn_fwd_t<data_type>::execute_forward() {
     MAYBE_UNUSED(ws_d);
 
     const int C = conf_.C();
-    const int H = conf_.H();
+    /* the spatial dims of 3D data are handled as 2D ones, d * h by w */
+    const int H = conf_.D() * conf_.H();
     const int W = conf_.W();
     const size_t stride_mb = data_d.blocking_desc().strides[0][0];
     const bool across_channels = conf_.desc()->alg_kind == lrn_across_channels;
@@ -149,7 +150,8 @@ void ref_lrn_bwd_t<data_type>::execute_backward() {
 
     const int MB = conf_.MB();
     const int C = conf_.C();
-    const int H = conf_.H();
+    /* the spatial dims of 3D data are handled as 2D ones, d * h by w */
+    const int H = conf_.D() * conf_.H();
     const int W = conf_.W();
     const size_t stride_mb = data_d.blocking_desc().strides[0][0];
     constexpr int blksize = fmt == nChw16c ? 16 : 8;
@@ -48,6 +48,11 @@ struct ref_lrn_fwd_t: public cpu_primitive_t {
                 && utils::one_of(desc()->alg_kind, lrn_across_channels,
                         lrn_within_channel)
                 && utils::everyone_is(data_type, desc()->data_desc.data_type)
+                && utils::implication(is_3d(), true
+                        && desc()->alg_kind == lrn_across_channels
+                        && utils::one_of(data_pd_.desc()->format,
+                            memory_format::ncdhw, memory_format::ndhwc,
+                            memory_format::nCdhw8c, memory_format::nCdhw16c))
                 && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
@@ -65,10 +70,10 @@ struct ref_lrn_fwd_t: public cpu_primitive_t {
     virtual void execute(event_t *e) {
         using namespace memory_format;
         switch (conf_.src_pd()->desc()->format) {
-        case nChw16c: execute_forward<nChw16c>(); break;
-        case nChw8c: execute_forward<nChw8c>(); break;
-        case nchw: execute_forward<nchw>(); break;
-        case nhwc: execute_forward<nhwc>(); break;
+        case nChw16c: case nCdhw16c: execute_forward<nChw16c>(); break;
+        case nChw8c: case nCdhw8c: execute_forward<nChw8c>(); break;
+        case nchw: case ncdhw: execute_forward<nchw>(); break;
+        case nhwc: case ndhwc: execute_forward<nhwc>(); break;
         case any: execute_forward<mkldnn_any>(); break;
         default: break;
         }
@@ -98,6 +103,10 @@ struct ref_lrn_bwd_t: public cpu_primitive_t {
                 && utils::one_of(desc()->alg_kind, lrn_across_channels
                         /*, lrn_within_channel */) // not supported yet
                 && utils::everyone_is(data_type, desc()->data_desc.data_type)
+                && utils::implication(is_3d(), utils::one_of(
+                            data_pd_.desc()->format, memory_format::ncdhw,
+                            memory_format::ndhwc, memory_format::nCdhw8c,
+                            memory_format::nCdhw16c))
                 && attr()->has_default_values();
             if (!ok) return status::unimplemented;
 
@@ -113,10 +122,10 @@ struct ref_lrn_bwd_t: public cpu_primitive_t {
     virtual void execute(event_t *e) {
         using namespace memory_format;
         switch (conf_.src_pd()->desc()->format) {
-        case nChw16c: execute_backward<nChw16c>(); break;
-        case nChw8c: execute_backward<nChw8c>(); break;
-        case nchw: execute_backward<nchw>(); break;
-        case nhwc: execute_backward<nhwc>(); break;
+        case nChw16c: case nCdhw16c: execute_backward<nChw16c>(); break;
+        case nChw8c: case nCdhw8c: execute_backward<nChw8c>(); break;
+        case nchw: case ncdhw: execute_backward<nchw>(); break;
+        case nhwc: case ndhwc: execute_backward<nhwc>(); break;
         case any: execute_backward<mkldnn_any>(); break;
         default: break;
         }
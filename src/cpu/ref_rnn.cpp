@@ -193,15 +193,9 @@ gemm_sig(_ref_rnn_common_t<aprop>::packed_gemm) {
             is_B_trans ? CblasTrans : CblasNoTrans, m, n, k, a_, strideA_m, b_,
             is_B_trans ? strideB_n : strideB_k, beta, c_, strideC_m);
 #else
-    UNUSED(m);
-    UNUSED(n);
-    UNUSED(k);
-    UNUSED(a_);
-    UNUSED(b_);
-    UNUSED(c_);
-    UNUSED(is_B_trans);
-    UNUSED(beta);
-    assert(!"packed gemm is disabled");
+    sgemm_compute("P", is_B_trans ? "T" : "N", &m, &n, &k, a_, &strideA_m,
+            b_, is_B_trans ? &strideB_n : &strideB_k, &beta, c_, &strideC_m,
+            nullptr, use_jit_sgemm_);
 #endif
 }
 
@@ -882,18 +876,27 @@ packing_sig(_ref_rnn_common_t<aprop>::pack_weights) {
         }
     }
 #else
-    UNUSED(n_layer);
-    UNUSED(n_direction);
-    UNUSED(n_weights);
-    UNUSED(n_gates);
-    UNUSED(n_parts);
-    UNUSED(gates_per_part);
-    UNUSED(batch);
-    UNUSED(OC_size);
-    UNUSED(IC_size);
-    UNUSED(weights_);
-    UNUSED(w_);
-    assert(!"packed gemm is disabled");
+    AOC<const float, 5> w(
+            w_, n_layer, n_direction, IC_size, n_gates, OC_size);
+    AOC<float *, 3> weights(weights_, n_layer, n_direction, n_parts);
+    bool is_fwd = aprop == prop_kind::forward;
+    int m = is_fwd ? n_gates * OC_size : IC_size;
+    int k = is_fwd ? IC_size : n_gates * OC_size;
+    const float one = 1.0f;
+    for (int i = 0; i < n_layer; i++) {
+        for (int d = 0; d < n_direction; d++) {
+            for (int p = 0; p < n_parts; p++) {
+                int m_p = is_fwd ? (gates_per_part[p] * OC_size) : m;
+                int k_p = is_fwd ? k : (gates_per_part[p] * OC_size);
+                int g = (p > 0) ? gates_per_part[p - 1] : 0;
+                size_t size = 0;
+                sgemm_pack_get_size("A", "N", "N", &m_p, &batch, &k_p, &size);
+                weights(i, d, p) = (float *)malloc(size, 64);
+                sgemm_pack("A", "N", "N", &m_p, &batch, &k_p, &one,
+                        &(w(i, d, 0, g, 0)), &m, weights(i, d, p));
+            }
+        }
+    }
 #endif
 }
 
@@ -965,11 +968,11 @@ free_packed_sig(_ref_rnn_common_t<aprop>::free_packed_weights) {
             for (int k = 0; k < n_parts; k++)
                 cblas_sgemm_free(weights(i, j, k));
 #else
-    UNUSED(n_layer);
-    UNUSED(n_direction);
-    UNUSED(n_parts);
-    UNUSED(weights_);
-    assert(!"packed gemm is disabled");
+    AOC<float *, 3> weights(weights_, n_layer, n_direction, n_parts);
+    for (int i = 0; i < n_layer; i++)
+        for (int j = 0; j < n_direction; j++)
+            for (int k = 0; k < n_parts; k++)
+                free(weights(i, j, k));
 #endif
 }
 
@@ -109,6 +109,25 @@ struct _ref_rnn_common_t : public cpu_primitive_t {
 
         DECLARE_COMMON_PD_T("ref:any", class_name);
 
+        /* the cells are sgemm calls */
+        virtual double efficiency() const override
+        { return this->engine()->efficiency("gemm"); }
+
+        virtual size_t scratchpad_size() const override {
+            /* the same layout as the primitive sets up; the helpers of the
+             * descriptor are not const */
+            pd_t pd(*this);
+            const bool is_bwd = aprop == prop_kind::backward;
+            size_t offsets[9];
+            return sizeof(float) * pd.set_offsets(pd.is_training(),
+                    offsets[0], offsets[1], offsets[2], offsets[3],
+                    pd.is_lbr(), offsets[4],
+                    pd.WL_LD() != pd.W_GLD(), offsets[5],
+                    pd.WI_LD() != pd.W_GLD(), offsets[6],
+                    is_bwd && pd.DWL_LD() != pd.DW_GLD(), offsets[7],
+                    is_bwd && pd.DWI_LD() != pd.DW_GLD(), offsets[8]);
+        }
+
         status_t init() {
             using namespace prop_kind;
             using namespace utils;
@@ -217,7 +236,10 @@ struct _ref_rnn_common_t : public cpu_primitive_t {
             (conf_.T() > 1) && (conf_.MB() == 32) &&
             (conf_.SIC() == 512) &&(conf_.SLC() == 512) && (conf_.DIC() == 512);
 #else
-        const bool weights_pack_cond = false;
+        /* the native packed gemm pays off when the weights are reused
+         * across many iterations with a small batch */
+        const bool weights_pack_cond = (aprop == prop_kind::forward)
+            && (conf_.T() > 1) && (conf_.MB() < 128);
 #endif
 
         const bool is_weights_state_packed = conf_.desc()->weights_iter_desc.format == packed_format;
@@ -0,0 +1,248 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <assert.h>
+#include <math.h>
+
+#include "c_types_map.hpp"
+#include "mkldnn_thread.hpp"
+#include "nstl.hpp"
+#include "type_helpers.hpp"
+
+#include "simple_lrn.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+using namespace simple_lrn;
+
+namespace {
+/* omega^-beta, with the powers of the common betas done by the roots */
+inline float fast_negative_powf(float omega, float beta) {
+    if (beta == 0.75f) return 1.0f / sqrtf(omega * sqrtf(omega));
+    if (beta == 1.0f) return 1.0f / omega;
+    if (beta == 0.5f) return 1.0f / sqrtf(omega);
+    return 1.0f / powf(omega, beta);
+}
+
+/* offset of the channel c of the point s of the flattened space */
+template <memory_format_t fmt>
+inline size_t data_off(size_t stride_mb, int C, int SP, int mb, int c, int s) {
+    using namespace memory_format;
+    constexpr int blksize = fmt == nChw16c ? 16 : 8;
+    switch (fmt) {
+    case nChw16c:
+    case nChw8c: return mb * stride_mb + (size_t)(c / blksize) * SP * blksize
+                 + (size_t)s * blksize + c % blksize;
+    case nchw: return mb * stride_mb + (size_t)c * SP + s;
+    case nhwc: return mb * stride_mb + (size_t)s * C + c;
+    default: assert(!"unsupported format"); return 0;
+    }
+}
+
+/* sq: squares of the tile, omega[c] = k + alpha / ls * sum of the squares in
+ * the window of the channel c */
+inline void compute_omega(float *omega, const float *sq, int C, int len,
+        int ls, float k, float alpha) {
+    const int half_ls = (ls - 1) / 2;
+    const float alpha_ls = alpha / ls;
+    for (int c = 0; c < C; ++c) {
+        const int c_st = nstl::max(c - half_ls, 0);
+        const int c_en = nstl::min(c + half_ls + 1, C);
+        float *o = &omega[c * sp_block];
+        PRAGMA_OMP_SIMD()
+        for (int s = 0; s < len; ++s) o[s] = 0;
+        for (int i = c_st; i < c_en; ++i) {
+            const float *q = &sq[i * sp_block];
+            PRAGMA_OMP_SIMD()
+            for (int s = 0; s < len; ++s) o[s] += q[s];
+        }
+        PRAGMA_OMP_SIMD()
+        for (int s = 0; s < len; ++s) o[s] = k + alpha_ls * o[s];
+    }
+}
+}
+
+template <impl::data_type_t data_type>
+simple_lrn_fwd_t<data_type>::simple_lrn_fwd_t(const pd_t *pd,
+        const input_vector &inputs, const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd) {
+    /* x, its squares and omega */
+    const size_t tile_size = 3 * conf_.C() * sp_block * sizeof(float);
+    scratchpad_ = create_scratchpad(mkldnn_get_max_threads() * tile_size);
+}
+
+template <impl::data_type_t data_type>
+template <memory_format_t fmt>
+void simple_lrn_fwd_t<data_type>::execute_forward() {
+    auto src = reinterpret_cast<const data_t *>(this->input_memory(0));
+    auto dst = reinterpret_cast<data_t *>(this->memory(0));
+    auto ws = reinterpret_cast<data_t *>(this->memory(1));
+
+    const memory_desc_wrapper data_d(conf_.src_pd());
+
+    const int MB = conf_.MB();
+    const int C = conf_.C();
+    const int SP = conf_.D() * conf_.H() * conf_.W();
+    const size_t stride_mb = data_d.blocking_desc().strides[0][0];
+
+    const int ls = conf_.desc()->local_size;
+    const float alpha = static_cast<float>(conf_.desc()->lrn_alpha);
+    const float beta = static_cast<float>(conf_.desc()->lrn_beta);
+    const float k = static_cast<float>(conf_.desc()->lrn_k);
+
+    const size_t tile_len = (size_t)C * sp_block;
+    auto scratch = reinterpret_cast<float *>(scratchpad_->get());
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        float *x = &scratch[3 * tile_len * ithr];
+        float *sq = &x[tile_len];
+        float *omega = &sq[tile_len];
+
+        for_nd(ithr, nthr, MB, utils::div_up(SP, (int)sp_block),
+                [&](int mb, int sp_blk) {
+            const int s0 = sp_blk * sp_block;
+            const int len = nstl::min((int)sp_block, SP - s0);
+
+            for (int c = 0; c < C; ++c) {
+                PRAGMA_OMP_SIMD()
+                for (int s = 0; s < len; ++s) {
+                    const float v = src[data_off<fmt>(stride_mb, C, SP, mb, c,
+                            s0 + s)];
+                    x[c * sp_block + s] = v;
+                    sq[c * sp_block + s] = v * v;
+                }
+            }
+
+            compute_omega(omega, sq, C, len, ls, k, alpha);
+
+            for (int c = 0; c < C; ++c) {
+                PRAGMA_OMP_SIMD()
+                for (int s = 0; s < len; ++s) {
+                    const int i = c * sp_block + s;
+                    const size_t off = data_off<fmt>(stride_mb, C, SP, mb, c,
+                            s0 + s);
+                    if (ws) ws[off] = static_cast<data_t>(omega[i]);
+                    dst[off] = static_cast<data_t>(
+                            x[i] * fast_negative_powf(omega[i], beta));
+                }
+            }
+        });
+    });
+}
+
+template <impl::data_type_t data_type>
+simple_lrn_bwd_t<data_type>::simple_lrn_bwd_t(const pd_t *pd,
+        const input_vector &inputs, const output_vector &outputs)
+    : cpu_primitive_t(&conf_, inputs, outputs), conf_(*pd) {
+    /* x, diff_dst, squares, omega^-beta and the terms of the sums */
+    const size_t tile_size = 5 * conf_.C() * sp_block * sizeof(float);
+    scratchpad_ = create_scratchpad(mkldnn_get_max_threads() * tile_size);
+}
+
+template <impl::data_type_t data_type>
+template <memory_format_t fmt>
+void simple_lrn_bwd_t<data_type>::execute_backward() {
+    auto src = reinterpret_cast<const data_t *>(this->input_memory(0));
+    auto diff_dst = reinterpret_cast<const data_t *>(this->input_memory(1));
+    auto diff_src = reinterpret_cast<data_t *>(this->memory(0));
+
+    const memory_desc_wrapper data_d(conf_.src_pd());
+
+    const int MB = conf_.MB();
+    const int C = conf_.C();
+    const int SP = conf_.D() * conf_.H() * conf_.W();
+    const size_t stride_mb = data_d.blocking_desc().strides[0][0];
+
+    const int ls = conf_.desc()->local_size;
+    const int half_ls = (ls - 1) / 2;
+    const float alpha = static_cast<float>(conf_.desc()->lrn_alpha);
+    const float beta = static_cast<float>(conf_.desc()->lrn_beta);
+    const float k = static_cast<float>(conf_.desc()->lrn_k);
+    const float coeff = 2.0f * alpha * beta / ls;
+
+    const size_t tile_len = (size_t)C * sp_block;
+    auto scratch = reinterpret_cast<float *>(scratchpad_->get());
+
+    parallel(0, [&](const int ithr, const int nthr) {
+        float *x = &scratch[5 * tile_len * ithr];
+        float *dd = &x[tile_len];
+        float *sq = &dd[tile_len];
+        float *pw = &sq[tile_len];
+        float *t = &pw[tile_len];
+
+        for_nd(ithr, nthr, MB, utils::div_up(SP, (int)sp_block),
+                [&](int mb, int sp_blk) {
+            const int s0 = sp_blk * sp_block;
+            const int len = nstl::min((int)sp_block, SP - s0);
+
+            for (int c = 0; c < C; ++c) {
+                PRAGMA_OMP_SIMD()
+                for (int s = 0; s < len; ++s) {
+                    const size_t off = data_off<fmt>(stride_mb, C, SP, mb, c,
+                            s0 + s);
+                    const float v = src[off];
+                    x[c * sp_block + s] = v;
+                    dd[c * sp_block + s] = diff_dst[off];
+                    sq[c * sp_block + s] = v * v;
+                }
+            }
+
+            compute_omega(pw, sq, C, len, ls, k, alpha);
+
+            /* t = diff_dst * x * omega^(-beta - 1) */
+            for (int c = 0; c < C; ++c) {
+                PRAGMA_OMP_SIMD()
+                for (int s = 0; s < len; ++s) {
+                    const int i = c * sp_block + s;
+                    const float o = pw[i];
+                    pw[i] = fast_negative_powf(o, beta);
+                    t[i] = dd[i] * x[i] * pw[i] / o;
+                }
+            }
+
+            for (int c = 0; c < C; ++c) {
+                const int c_st = nstl::max(c - half_ls, 0);
+                const int c_en = nstl::min(c + half_ls + 1, C);
+                float B[sp_block];
+                PRAGMA_OMP_SIMD()
+                for (int s = 0; s < len; ++s) B[s] = 0;
+                for (int i = c_st; i < c_en; ++i) {
+                    PRAGMA_OMP_SIMD()
+                    for (int s = 0; s < len; ++s)
+                        B[s] += t[i * sp_block + s];
+                }
+                PRAGMA_OMP_SIMD()
+                for (int s = 0; s < len; ++s) {
+                    const int i = c * sp_block + s;
+                    diff_src[data_off<fmt>(stride_mb, C, SP, mb, c, s0 + s)]
+                        = static_cast<data_t>(pw[i] * dd[i]
+                                - coeff * x[i] * B[s]);
+                }
+            }
+        });
+    });
+}
+
+template struct simple_lrn_fwd_t<data_type::f32>;
+template struct simple_lrn_bwd_t<data_type::f32>;
+
+}
+}
+}
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -0,0 +1,167 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_LRN_HPP
+#define CPU_SIMPLE_LRN_HPP
+
+#include <assert.h>
+
+#include "c_types_map.hpp"
+#include "cpu_lrn_pd.hpp"
+#include "cpu_engine.hpp"
+#include "scratchpad.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+namespace mkldnn {
+namespace impl {
+namespace cpu {
+
+/* LRN across channels with any odd local size and any beta, for the plain,
+ * channels last and blocked by 8 or 16 layouts of 4D and 5D data.
+ *
+ * The channels of a few points of space are copied to a tile (channels by
+ * points) so that the sums over the window and the powers are computed for
+ * all the points at once, whatever the layout. The JIT implementations stay
+ * in front for the parameters they support (local size 5, beta 0.75). */
+namespace simple_lrn {
+/* the number of points of space in a tile */
+enum { sp_block = 16 };
+
+inline bool format_ok(memory_format_t fmt, int ndims) {
+    using namespace memory_format;
+    return ndims == 4
+        ? utils::one_of(fmt, nchw, nhwc, nChw8c, nChw16c)
+        : utils::one_of(fmt, ncdhw, ndhwc, nCdhw8c, nCdhw16c);
+}
+}
+
+template <impl::data_type_t data_type>
+struct simple_lrn_fwd_t: public cpu_primitive_t {
+    struct pd_t: public cpu_lrn_fwd_pd_t {
+        pd_t(engine_t *engine, const lrn_desc_t *adesc,
+                const primitive_attr_t *attr, const lrn_fwd_pd_t *hint_fwd_pd)
+            : cpu_lrn_fwd_pd_t(engine, adesc, attr, hint_fwd_pd) {}
+
+        DECLARE_COMMON_PD_T("simple:any", simple_lrn_fwd_t);
+
+        virtual status_t init() override {
+            using namespace prop_kind;
+            using namespace alg_kind;
+            assert(engine()->kind() == engine_kind::cpu);
+            const memory_desc_wrapper data_d(data_pd_.desc());
+            bool ok = true
+                && utils::one_of(desc()->prop_kind, forward_training,
+                        forward_inference)
+                && desc()->alg_kind == lrn_across_channels
+                && utils::everyone_is(data_type, desc()->data_desc.data_type)
+                && !has_zero_dim_memory()
+                && desc()->local_size % 2 == 1
+                && simple_lrn::format_ok(data_d.format(), data_d.ndims())
+                && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            if (desc_.prop_kind == forward_training) { ws_pd_ = data_pd_; }
+
+            return status::success;
+        }
+    };
+
+    simple_lrn_fwd_t(const pd_t *pd, const input_vector &inputs,
+            const output_vector &outputs);
+    ~simple_lrn_fwd_t() { delete scratchpad_; }
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual void execute(event_t *e) {
+        using namespace memory_format;
+        switch (conf_.src_pd()->desc()->format) {
+        case nChw16c: case nCdhw16c: execute_forward<nChw16c>(); break;
+        case nChw8c: case nCdhw8c: execute_forward<nChw8c>(); break;
+        case nchw: case ncdhw: execute_forward<nchw>(); break;
+        case nhwc: case ndhwc: execute_forward<nhwc>(); break;
+        default: assert(!"unsupported format");
+        }
+        e->set_state(event_t::ready);
+    }
+
+private:
+    template <memory_format_t fmt> void execute_forward();
+    pd_t conf_;
+    scratchpad_t *scratchpad_;
+};
+
+template <impl::data_type_t data_type>
+struct simple_lrn_bwd_t: public cpu_primitive_t {
+    struct pd_t: public cpu_lrn_bwd_pd_t {
+        pd_t(engine_t *engine, const lrn_desc_t *adesc,
+                const primitive_attr_t *attr, const lrn_fwd_pd_t *hint_fwd_pd)
+            : cpu_lrn_bwd_pd_t(engine, adesc, attr, hint_fwd_pd) {}
+
+        DECLARE_COMMON_PD_T("simple:any", simple_lrn_bwd_t);
+
+        virtual status_t init() override {
+            using namespace prop_kind;
+            using namespace alg_kind;
+            assert(engine()->kind() == engine_kind::cpu);
+            const memory_desc_wrapper data_d(data_pd_.desc());
+            bool ok = true
+                && utils::one_of(desc()->prop_kind, backward_data)
+                && desc()->alg_kind == lrn_across_channels
+                && utils::everyone_is(data_type, desc()->data_desc.data_type,
+                        desc()->diff_data_desc.data_type)
+                && !has_zero_dim_memory()
+                && desc()->local_size % 2 == 1
+                && simple_lrn::format_ok(data_d.format(), data_d.ndims())
+                && diff_data_pd_.desc()->format == data_d.format()
+                && attr()->has_default_values();
+            if (!ok) return status::unimplemented;
+
+            return status::success;
+        }
+    };
+
+    simple_lrn_bwd_t(const pd_t *pd, const input_vector &inputs,
+            const output_vector &outputs);
+    ~simple_lrn_bwd_t() { delete scratchpad_; }
+
+    typedef typename prec_traits<data_type>::type data_t;
+
+    virtual void execute(event_t *e) {
+        using namespace memory_format;
+        switch (conf_.src_pd()->desc()->format) {
+        case nChw16c: case nCdhw16c: execute_backward<nChw16c>(); break;
+        case nChw8c: case nCdhw8c: execute_backward<nChw8c>(); break;
+        case nchw: case ncdhw: execute_backward<nchw>(); break;
+        case nhwc: case ndhwc: execute_backward<nhwc>(); break;
+        default: assert(!"unsupported format");
+        }
+        e->set_state(event_t::ready);
+    }
+
+private:
+    template <memory_format_t fmt> void execute_backward();
+    pd_t conf_;
+    scratchpad_t *scratchpad_;
+};
+
+}
+}
+}
+
+#endif
+
+// vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
@@ -149,6 +149,7 @@ struct res_t {
     res_state_t state;
     size_t errors, total;
     benchdnn_timer_t timer;
+    double est_ms, est_mem; /* library estimates of time and extra memory */
 };
 
 void parse_result(res_t &res, bool &want_perf_report, bool allow_unimpl,
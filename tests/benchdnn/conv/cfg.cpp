@@ -58,6 +58,14 @@ const _dt_conf_t conf_f32_wino = {
     {mkldnn_f32,},
 };
 
+const _dt_conf_t conf_f32_fft = {
+    {mkldnn_f32, -FLT_MAX, FLT_MAX,  -16, 128, 3, 1, .25, 1e-5},
+    {mkldnn_f32, -FLT_MAX, FLT_MAX,  2,  64, 2, 1, .75, 1e-5},
+    {mkldnn_f32, -FLT_MAX, FLT_MAX,  1, 128, 1, 1, .25,  2e-7},
+    {mkldnn_f32, -FLT_MAX, FLT_MAX, -16, 128, 3, 1, .25, 1e-5},
+    {mkldnn_f32,},
+};
+
 const _dt_conf_t conf_s16s16s32s32 = {
     {mkldnn_s16, INT16_MIN, INT16_MAX, -4,  4, 0, 1, .25, 0.},
     {mkldnn_s16, INT16_MIN, INT16_MAX, -5,  5, 0, 1, .25, 0.},
@@ -184,6 +192,7 @@ const dt_conf_t *str2cfg(const char *str) {
     CASE(f32);
     CASE(f32_full);
     CASE(f32_wino);
+    CASE(f32_fft);
     CASE(s16s16s32s32);
     CASE(s32s16s16s32);
     CASE(s16s32s16s32);
@@ -209,6 +218,7 @@ const char *cfg2str(const dt_conf_t *cfg) {
     CASE(f32);
     CASE(f32_full);
     CASE(f32_wino);
+    CASE(f32_fft);
     CASE(s16s16s32s32);
     CASE(s32s16s16s32);
     CASE(s16s32s16s32);
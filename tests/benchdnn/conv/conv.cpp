@@ -89,9 +89,9 @@ inline double get_eps(const prb_t *p, const data_kind_t kind) {
 
 inline void get_result(const prb_t *p, const data_kind_t kind, res_t *r,
         const diff_norm_t diff_norm) {
-    bool wino_test = (p->alg & WINO)
+    bool wino_test = (p->alg == WINO || p->alg == FFT)
         && (diff_norm.rel_diff(norm_t::L2) <= get_eps(p, kind));
-    /* Ignoring elementwise errors for winograd,
+    /* Ignoring elementwise errors for winograd and fft,
        since large relative error in few elements(which are anyways close to zero)
        results in false positive failures*/
     if (wino_test) r->errors = 0;
@@ -150,7 +150,7 @@ inline int compare_dat(const prb_t *p, data_kind_t kind, dnn_mem_t &mem_dt,
         }
         if (!ok) {
             r->errors++;
-            if ((!(p->alg & WINO) && r->errors < 10) || verbose >=10) {
+            if ((p->alg == DIRECT && r->errors < 10) || verbose >=10) {
                 int mb_or_g = 0, g_or_oc = 0, c = 0, d = 0, h = 0, w = 0;
                 switch (kind) {
                 case SRC: inv_src_off_f(p, i, mb_or_g, g_or_oc, c, d, h, w); break;
@@ -432,6 +432,7 @@ inline int init_pd(const prb_t *p, mkldnn_convolution_desc_t &cd,
 
     mkldnn_alg_kind_t alg = mkldnn_convolution_direct;
     if (p->alg == WINO) alg = mkldnn_convolution_winograd;
+    if (p->alg == FFT) alg = mkldnn_convolution_fft;
 
     switch (p->dir) {
     case FWD_D: case FWD_B: case FWD_I:
@@ -489,6 +490,7 @@ inline int init_pd(const prb_t *p, mkldnn_convolution_desc_t &cd,
     } else {
         print(5, "mkldnn implementation: %s\n", impl_str);
     }
+    query_estimates(cpd, r);
 
     auto q = [=](mkldnn_query_t query, int index = 0) {
         return *mkldnn_primitive_desc_query_memory_d(
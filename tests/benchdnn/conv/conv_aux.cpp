@@ -32,6 +32,7 @@ alg_t str2alg(const char *str) {
 #define CASE(_alg) if (!strcasecmp(STRINGIFY(_alg), str)) return _alg
     CASE(DIRECT);
     CASE(WINO);
+    CASE(FFT);
 #undef CASE
     assert(!"unknown algorithm");
     return DIRECT;
@@ -40,6 +41,7 @@ alg_t str2alg(const char *str) {
 const char *alg2str(alg_t alg) {
     if (alg == DIRECT) return "direct";
     if (alg == WINO) return "wino";
+    if (alg == FFT) return "fft";
     assert(!"unknown algorithm");
     return "unknown algorithm";
 }
@@ -28,7 +28,7 @@
 
 namespace conv {
 
-enum alg_t { DIRECT, WINO };
+enum alg_t { DIRECT, WINO, FFT };
 alg_t str2alg(const char *str);
 const char *alg2str(alg_t alg);
 
@@ -79,6 +79,7 @@ typedef struct dt_conf_t {
 extern const _dt_conf_t conf_f32;
 extern const _dt_conf_t conf_f32_full;
 extern const _dt_conf_t conf_f32_wino;
+extern const _dt_conf_t conf_f32_fft;
 extern const _dt_conf_t conf_s16s16s32s32;
 extern const _dt_conf_t conf_s32s16s16s32;
 extern const _dt_conf_t conf_s16s32s16s32;
@@ -147,6 +147,7 @@ inline int init_pd(const prb_t *p, mkldnn_deconvolution_desc_t &cd,
     } else {
         print(5, "mkldnn implementation: %s\n", impl_str);
     }
+    query_estimates(dpd, r);
 
     auto q = [=](mkldnn_query_t query, int index = 0) {
         return *mkldnn_primitive_desc_query_memory_d(
@@ -48,6 +48,8 @@ table of modifiers below.
 | %@t           | time in ms
 | %@c           | time in clocks
 | %@p           | ops per second
+| %e            | time in ms estimated by the library
+| %m            | extra memory in bytes reported by the library
 
 | modifier  | description
 |:--------  |:-----------
@@ -129,6 +131,10 @@ void perf_report(const prb_t *p, const res_t *r, const char *pstr) {
             DPRINT("%g", t.ticks(mode) / unit);
         else if (c == 'p')
             DPRINT("%g", p->ops / t.ms(mode) / unit * 1e3);
+        else if (c == 'e')
+            DPRINT("%g", r->est_ms / unit);
+        else if (c == 'm')
+            DPRINT("%g", r->est_mem / unit);
         else
             []() { SAFE(FAIL, CRIT); return 0; }();
     }
@@ -124,6 +124,8 @@ data_kind_t fmt2data_kind(mkldnn_memory_format_t fmt) {
     case mkldnn_gOIdhw16o16i:
     case mkldnn_gOidhw16o:
     case mkldnn_gOdhwi16o:
+    case mkldnn_Goidhw8g:
+    case mkldnn_Goidhw16g:
         return GWEI;
 
     default: return WEI;
@@ -21,6 +21,8 @@
 #include <stdint.h>
 #include "mkldnn.h"
 
+#include "tests/test_threadpool.hpp"
+
 #include "common.hpp"
 #include "dnn_types.hpp"
 #include "mkldnn_debug.hpp"
@@ -85,6 +87,7 @@ inline int execute(mkldnn_primitive_t p) {
 }
 
 inline int init() {
+    test_threadpool::set_default_threadpool();
     DNN_SAFE(mkldnn_engine_create(&engine, mkldnn_cpu, 0), CRIT);
     return OK;
 }
@@ -100,4 +103,17 @@ inline const char *query_impl_info(const_mkldnn_primitive_desc_t pd) {
     return str;
 }
 
+/* the library estimates of the time and the extra memory, for the perf
+ * report; left zero if the library provides none */
+inline void query_estimates(const_mkldnn_primitive_desc_t pd, res_t *r) {
+    double sec = 0;
+    if (mkldnn_primitive_desc_query(pd, mkldnn_query_time_estimate_f64, 0,
+                &sec) == mkldnn_success)
+        r->est_ms = 1e3 * sec;
+    ptrdiff_t bytes = 0;
+    if (mkldnn_primitive_desc_query(pd, mkldnn_query_memory_consumption_s64,
+                0, &bytes) == mkldnn_success)
+        r->est_mem = (double)bytes;
+}
+
 #endif
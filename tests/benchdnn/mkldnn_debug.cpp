@@ -150,6 +150,8 @@ mkldnn_memory_format_t str2fmt(const char *str) {
     CASE(Odhwi16o);
     CASE(gOidhw16o);
     CASE(gOdhwi16o);
+    CASE(Goidhw8g);
+    CASE(Goidhw16g);
     CASE(ntc);
     CASE(tnc);
     CASE(ldsnc);
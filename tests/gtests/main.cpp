@@ -16,11 +16,14 @@
 
 #include "gtest/gtest.h"
 
+#include "tests/test_threadpool.hpp"
+
 int main( int argc, char* argv[ ] )
 {
     int result;
     {
         ::testing::InitGoogleTest(&argc, argv);
+        test_threadpool::set_default_threadpool();
 #if _WIN32
         // Safety cleanup.
         system("where /q umdh && del pre_cpu.txt");
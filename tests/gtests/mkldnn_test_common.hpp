@@ -270,6 +270,8 @@ inline mkldnn::memory::desc create_md(mkldnn::memory::dims dims,
     case f::gOIdhw8o8i:
     case f::gOIdhw16o16i:
     case f::gOdhwi16o:
+    case f::Goidhw8g:
+    case f::Goidhw16g:
     case f::goidhw:
         ndims = 6; break;
     case f::format_undef:
@@ -315,6 +315,10 @@ protected:
         Forward(use_scale_shift, training);
         Forward(use_scale_shift | use_global_stats, training);
 
+        ForwardResidual(0u, scoring, false);
+        ForwardResidual(use_scale_shift, training, true);
+        ForwardResidual(use_scale_shift | use_global_stats, scoring, true);
+
         Backward(0u, backward_data);
         Backward(omit_stats, backward_data);
         Backward(use_scale_shift, backward);
@@ -365,6 +369,47 @@ protected:
 
     }
 
+    /* dst = [relu](bn(src) + dst) with the sum [and relu] post-ops, checked
+     * against the output of the primitive without the post-ops */
+    void ForwardResidual(unsigned flags, prop_kind pk, bool with_relu) {
+        Forward(flags, pk);
+
+        const size_t size = dst->get_size() / sizeof(data_t);
+        auto dst_data = (data_t *)dst->get().get_data_handle();
+        std::vector<data_t> bn_dst(dst_data, dst_data + size);
+
+        fill(dst->get());
+        check_zero_tail<data_t>(1, dst->get());
+        std::vector<data_t> residual(dst_data, dst_data + size);
+
+        auto bnrm_desc = batch_normalization_forward::desc(pk,
+                    *data_desc, p.eps, flags);
+        post_ops ops;
+        ops.append_sum(1.f);
+        if (with_relu)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        bnrm_prim_desc.reset(new batch_normalization_forward::primitive_desc(
+                    bnrm_desc, attr, *eng));
+
+        auto bn = createBnrmFwd(pk == prop_kind::forward_training,
+                flags & use_global_stats, flags & use_scale_shift);
+        std::vector<primitive> pipeline;
+        pipeline.push_back(bn);
+        stream(stream::kind::lazy).submit(pipeline).wait();
+
+        check_zero_tail<data_t>(0, dst->get());
+
+        mkldnn::impl::parallel_nd(size, [&](size_t i) {
+            data_t ref = bn_dst[i] + residual[i];
+            if (with_relu && ref < 0) ref = 0;
+            data_t norm_max = std::max(fabs(dst_data[i]), fabs(ref));
+            if (norm_max < 10e-3) norm_max = data_t(1);
+            EXPECT_NEAR((dst_data[i] - ref) / norm_max, 0., 1e-6);
+        });
+    }
+
     void Backward(unsigned flags, prop_kind pk) {
         bool useScaleShift = flags & use_scale_shift;
 
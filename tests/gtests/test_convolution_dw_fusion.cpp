@@ -0,0 +1,190 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+struct dw_fusion_test_params {
+    int mb, ic, oc, h, w;
+    int dw_stride;
+    bool relu_1x1, relu_dw, with_bias;
+};
+
+/* 1x1 convolution (nchw) followed by a 3x3 depthwise convolution with
+ * padding 1; relus are applied in place of the corresponding post-ops */
+static void compute_ref_1x1_dw(const dw_fusion_test_params &p,
+        const float *src, const float *wei, const float *bias,
+        const float *dw_wei, const float *dw_bias, float *dst) {
+    const int oh_dw = (p.h - 1) / p.dw_stride + 1;
+    const int ow_dw = (p.w - 1) / p.dw_stride + 1;
+    std::vector<float> mid((size_t)p.mb * p.oc * p.h * p.w);
+
+    mkldnn::impl::parallel_nd(p.mb, p.oc, p.h, p.w,
+        [&](int n, int oc, int h, int w) {
+        float a = bias ? bias[oc] : 0.f;
+        for (int ic = 0; ic < p.ic; ++ic)
+            a += src[((size_t)(n * p.ic + ic) * p.h + h) * p.w + w]
+                * wei[oc * p.ic + ic];
+        if (p.relu_1x1 && a < 0) a = 0;
+        mid[((size_t)(n * p.oc + oc) * p.h + h) * p.w + w] = a;
+    });
+
+    mkldnn::impl::parallel_nd(p.mb, p.oc, oh_dw, ow_dw,
+        [&](int n, int c, int oh, int ow) {
+        float a = dw_bias ? dw_bias[c] : 0.f;
+        for (int kh = 0; kh < 3; ++kh)
+        for (int kw = 0; kw < 3; ++kw) {
+            const int ih = oh * p.dw_stride - 1 + kh;
+            const int iw = ow * p.dw_stride - 1 + kw;
+            if (ih < 0 || ih >= p.h || iw < 0 || iw >= p.w) continue;
+            a += mid[((size_t)(n * p.oc + c) * p.h + ih) * p.w + iw]
+                * dw_wei[c * 9 + kh * 3 + kw];
+        }
+        if (p.relu_dw && a < 0) a = 0;
+        dst[((size_t)(n * p.oc + c) * oh_dw + oh) * ow_dw + ow] = a;
+    });
+}
+
+class convolution_dw_fusion_test
+    : public ::testing::TestWithParam<dw_fusion_test_params> {
+protected:
+    virtual void SetUp() {
+        auto p = ::testing::TestWithParam<dw_fusion_test_params>::GetParam();
+        auto eng = engine(engine::kind::cpu, 0);
+        const auto f32 = memory::data_type::f32;
+        const auto fmt_any = memory::format::any;
+
+        const int oh_dw = (p.h - 1) / p.dw_stride + 1;
+        const int ow_dw = (p.w - 1) / p.dw_stride + 1;
+
+        memory::dims src_dims = { p.mb, p.ic, p.h, p.w };
+        memory::dims wei_dims = { p.oc, p.ic, 1, 1 };
+        memory::dims bia_dims = { p.oc };
+        memory::dims dst_dims = { p.mb, p.oc, p.h, p.w };
+        memory::dims dst_dw_dims = { p.mb, p.oc, oh_dw, ow_dw };
+
+        auto src = memory({{{ src_dims }, f32, memory::format::nchw }, eng});
+        auto wei = memory({{{ wei_dims }, f32, memory::format::oihw }, eng});
+        auto bia = memory({{{ bia_dims }, f32, memory::format::x }, eng});
+        auto dst = memory({{{ dst_dw_dims }, f32, memory::format::nchw },
+                eng});
+
+        fill_data<float>(src.get_primitive_desc().get_size() / sizeof(float),
+                (float *)src.get_data_handle(), 1., true);
+        fill_data<float>(wei.get_primitive_desc().get_size() / sizeof(float),
+                (float *)wei.get_data_handle(), 1., true);
+        fill_data<float>(bia.get_primitive_desc().get_size() / sizeof(float),
+                (float *)bia.get_data_handle(), 1., true);
+
+        std::vector<float> dw_wei((size_t)p.oc * 9), dw_bia(p.oc);
+        fill_data<float>(dw_wei.size(), dw_wei.data(), 1., true);
+        fill_data<float>(dw_bia.size(), dw_bia.data(), 1., true);
+
+        post_ops ops;
+        if (p.relu_1x1)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        ops.append_dw_conv(p.dw_stride, dw_wei.data(),
+                p.with_bias ? dw_bia.data() : nullptr);
+        if (p.relu_dw)
+            ops.append_eltwise(1.f, algorithm::eltwise_relu, 0.f, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+
+        memory::desc src_md({ src_dims }, f32, fmt_any);
+        memory::desc wei_md({ wei_dims }, f32, fmt_any);
+        memory::desc bia_md({ bia_dims }, f32, fmt_any);
+        memory::desc dst_md({ dst_dims }, f32, fmt_any);
+        memory::dims strides = { 1, 1 }, padding = { 0, 0 };
+
+        auto conv_desc = p.with_bias
+            ? convolution_forward::desc(prop_kind::forward_inference,
+                    algorithm::convolution_direct, src_md, wei_md, bia_md,
+                    dst_md, strides, padding, padding, padding_kind::zero)
+            : convolution_forward::desc(prop_kind::forward_inference,
+                    algorithm::convolution_direct, src_md, wei_md, dst_md,
+                    strides, padding, padding, padding_kind::zero);
+
+        std::shared_ptr<convolution_forward::primitive_desc> conv_pd;
+        try {
+            conv_pd.reset(new convolution_forward::primitive_desc(conv_desc,
+                        attr, eng));
+        } catch (error &e) {
+            /* the fused implementation needs avx512 */
+            if (e.status == mkldnn_unimplemented) return;
+            throw;
+        }
+
+        /* the primitive writes the output of the depthwise convolution */
+        auto conv_dst_md = conv_pd->dst_primitive_desc().desc();
+        for (int d = 0; d < 4; ++d)
+            ASSERT_EQ(conv_dst_md.data.dims[d], dst_dw_dims[d]);
+
+        auto conv_src = memory(conv_pd->src_primitive_desc());
+        auto conv_wei = memory(conv_pd->weights_primitive_desc());
+        auto conv_dst = memory(conv_pd->dst_primitive_desc());
+
+        std::vector<primitive> pipeline;
+        pipeline.push_back(reorder(src, conv_src));
+        pipeline.push_back(reorder(wei, conv_wei));
+        if (p.with_bias)
+            pipeline.push_back(convolution_forward(*conv_pd, conv_src,
+                        conv_wei, bia, conv_dst));
+        else
+            pipeline.push_back(convolution_forward(*conv_pd, conv_src,
+                        conv_wei, conv_dst));
+        pipeline.push_back(reorder(conv_dst, dst));
+        stream(stream::kind::eager).submit(pipeline).wait();
+
+        std::vector<float> ref((size_t)p.mb * p.oc * oh_dw * ow_dw);
+        compute_ref_1x1_dw(p, (const float *)src.get_data_handle(),
+                (const float *)wei.get_data_handle(),
+                p.with_bias ? (const float *)bia.get_data_handle() : nullptr,
+                dw_wei.data(), p.with_bias ? dw_bia.data() : nullptr,
+                ref.data());
+
+        const float *out = (const float *)dst.get_data_handle();
+        for (size_t i = 0; i < ref.size(); ++i) {
+            const float diff = std::fabs(out[i] - ref[i]);
+            const float e = std::fabs(ref[i]) > 1e-4f
+                ? diff / std::fabs(ref[i]) : diff;
+            ASSERT_LE(e, 1e-4f) << "at " << i;
+        }
+    }
+};
+
+TEST_P(convolution_dw_fusion_test, TestsFusion) {}
+
+INSTANTIATE_TEST_CASE_P(TestConvolutionDwFusion, convolution_dw_fusion_test,
+    ::testing::Values(
+        dw_fusion_test_params{ 2, 16, 32, 14, 14, 1, true, true, true },
+        dw_fusion_test_params{ 2, 16, 32, 14, 14, 2, true, true, true },
+        dw_fusion_test_params{ 1, 24, 144, 56, 56, 1, true, true, true },
+        dw_fusion_test_params{ 1, 24, 144, 56, 56, 2, true, false, true },
+        dw_fusion_test_params{ 2, 32, 192, 28, 28, 1, false, true, false },
+        dw_fusion_test_params{ 1, 64, 384, 15, 15, 2, true, true, true },
+        dw_fusion_test_params{ 3, 8, 20, 7, 9, 1, true, true, true },
+        dw_fusion_test_params{ 3, 8, 20, 7, 9, 2, false, false, true },
+        dw_fusion_test_params{ 1, 16, 16, 2, 3, 1, true, true, true },
+        dw_fusion_test_params{ 1, 160, 960, 7, 7, 1, true, true, true }
+    ));
+
+}
@@ -0,0 +1,284 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+/* FFT convolutions with stride 1 on plain tensors; kh == 0 stands for a 1D
+ * convolution (ncw) */
+struct fft_test_params {
+    int mb, g, ic, oc, ih, iw, kh, kw, pad;
+};
+
+static bool is_1d(const fft_test_params &p) { return p.kh == 0; }
+static int fft_ih(const fft_test_params &p) { return is_1d(p) ? 1 : p.ih; }
+static int fft_kh(const fft_test_params &p) { return is_1d(p) ? 1 : p.kh; }
+static int fft_ph(const fft_test_params &p) { return is_1d(p) ? 0 : p.pad; }
+static int fft_oh(const fft_test_params &p)
+{ return fft_ih(p) + 2 * fft_ph(p) - fft_kh(p) + 1; }
+static int fft_ow(const fft_test_params &p)
+{ return p.iw + 2 * p.pad - p.kw + 1; }
+
+/* calls f(iy, ix, wei_idx) for the taps of output pixel (y, x) of channel
+ * oc of group g that fall inside the input */
+template <typename F>
+static void for_taps(const fft_test_params &p, int g, int oc, int ic, int y,
+        int x, F f) {
+    const int IC = p.ic / p.g, OC = p.oc / p.g, KH = fft_kh(p);
+    for (int kh = 0; kh < KH; ++kh)
+    for (int kw = 0; kw < p.kw; ++kw) {
+        const int iy = y - fft_ph(p) + kh, ix = x - p.pad + kw;
+        if (iy < 0 || iy >= fft_ih(p) || ix < 0 || ix >= p.iw) continue;
+        f(iy, ix, (((size_t)g * OC + oc) * IC + ic) * KH * p.kw
+                + kh * p.kw + kw);
+    }
+}
+
+static void compute_ref_fwd(const fft_test_params &p, const float *src,
+        const float *wei, const float *bias, float *dst) {
+    const int oh = fft_oh(p), ow = fft_ow(p), ih = fft_ih(p);
+    const int IC = p.ic / p.g, OC = p.oc / p.g;
+    mkldnn::impl::parallel_nd(p.mb, p.oc, oh, ow,
+        [&](int n, int oc, int y, int x) {
+        const int g = oc / OC;
+        float a = bias[oc];
+        for (int ic = 0; ic < IC; ++ic)
+            for_taps(p, g, oc % OC, ic, y, x, [&](int iy, int ix, size_t w) {
+                a += src[((n * p.ic + g * IC + ic) * ih + iy) * p.iw + ix]
+                    * wei[w];
+            });
+        dst[((n * p.oc + oc) * oh + y) * ow + x] = a;
+    });
+}
+
+static void compute_ref_bwd_data(const fft_test_params &p,
+        const float *diff_dst, const float *wei, float *diff_src) {
+    const int oh = fft_oh(p), ow = fft_ow(p), ih = fft_ih(p);
+    const int IC = p.ic / p.g, OC = p.oc / p.g;
+    const size_t src_size = (size_t)p.mb * p.ic * ih * p.iw;
+    for (size_t i = 0; i < src_size; ++i) diff_src[i] = 0.f;
+    mkldnn::impl::parallel_nd(p.mb, p.ic, [&](int n, int c) {
+        const int g = c / IC, ic = c % IC;
+        for (int oc = 0; oc < OC; ++oc)
+        for (int y = 0; y < oh; ++y)
+        for (int x = 0; x < ow; ++x) {
+            const float d
+                = diff_dst[((n * p.oc + g * OC + oc) * oh + y) * ow + x];
+            for_taps(p, g, oc, ic, y, x, [&](int iy, int ix, size_t w) {
+                diff_src[((n * p.ic + c) * ih + iy) * p.iw + ix]
+                    += d * wei[w];
+            });
+        }
+    });
+}
+
+static void compute_ref_bwd_weights(const fft_test_params &p,
+        const float *src, const float *diff_dst, float *diff_wei,
+        float *diff_bias) {
+    const int oh = fft_oh(p), ow = fft_ow(p), ih = fft_ih(p);
+    const int IC = p.ic / p.g, OC = p.oc / p.g;
+    const size_t wei_size = (size_t)p.oc * IC * fft_kh(p) * p.kw;
+    for (size_t i = 0; i < wei_size; ++i) diff_wei[i] = 0.f;
+    mkldnn::impl::parallel_nd(p.g, OC, IC, [&](int g, int oc, int ic) {
+        for (int n = 0; n < p.mb; ++n)
+        for (int y = 0; y < oh; ++y)
+        for (int x = 0; x < ow; ++x) {
+            const float d
+                = diff_dst[((n * p.oc + g * OC + oc) * oh + y) * ow + x];
+            for_taps(p, g, oc, ic, y, x, [&](int iy, int ix, size_t w) {
+                diff_wei[w] += d
+                    * src[((n * p.ic + g * IC + ic) * ih + iy) * p.iw + ix];
+            });
+        }
+    });
+    mkldnn::impl::parallel_nd(p.oc, [&](int oc) {
+        float a = 0.f;
+        for (int n = 0; n < p.mb; ++n)
+        for (int i = 0; i < oh * ow; ++i)
+            a += diff_dst[(n * p.oc + oc) * oh * ow + i];
+        diff_bias[oc] = a;
+    });
+}
+
+static void compare(const std::vector<float> &ref, const float *out) {
+    /* the rounding errors of the transforms scale with the magnitude of the
+     * terms of a sum rather than with the sum itself */
+    for (size_t i = 0; i < ref.size(); ++i) {
+        const float e = std::fabs(out[i] - ref[i])
+            / std::max(1.f, std::fabs(ref[i]));
+        ASSERT_LE(e, 5e-4f) << "at " << i;
+    }
+}
+
+class convolution_fft_test
+    : public ::testing::TestWithParam<fft_test_params> {
+protected:
+    fft_test_params p;
+    engine eng = engine(engine::kind::cpu, 0);
+    memory::dims src_dims, wei_dims, bia_dims, dst_dims;
+    memory::dims strides, padding;
+    memory::format data_fmt, wei_fmt;
+
+    memory::desc md(const memory::dims &dims, memory::format fmt) {
+        return memory::desc(dims, memory::data_type::f32, fmt);
+    }
+
+    memory filled(const memory::dims &dims, memory::format fmt) {
+        auto m = memory({ md(dims, fmt), eng });
+        fill_data<float>(m.get_primitive_desc().get_size() / sizeof(float),
+                (float *)m.get_data_handle(), 1., true);
+        return m;
+    }
+
+    convolution_forward::primitive_desc fwd_pd() {
+        auto desc = convolution_forward::desc(prop_kind::forward_training,
+                algorithm::convolution_fft, md(src_dims, data_fmt),
+                md(wei_dims, wei_fmt), md(bia_dims, memory::format::x),
+                md(dst_dims, data_fmt), strides, padding, padding,
+                padding_kind::zero);
+        return convolution_forward::primitive_desc(desc, eng);
+    }
+
+    virtual void SetUp() {
+        p = ::testing::TestWithParam<fft_test_params>::GetParam();
+        const bool with_groups = p.g > 1;
+        const int IC = p.ic / p.g, OC = p.oc / p.g;
+        if (is_1d(p)) {
+            src_dims = { p.mb, p.ic, p.iw };
+            dst_dims = { p.mb, p.oc, fft_ow(p) };
+            wei_dims = with_groups
+                ? memory::dims{ p.g, OC, IC, p.kw }
+                : memory::dims{ p.oc, p.ic, p.kw };
+            strides = { 1 };
+            padding = { p.pad };
+            data_fmt = memory::format::ncw;
+            wei_fmt = with_groups ? memory::format::goiw : memory::format::oiw;
+        } else {
+            src_dims = { p.mb, p.ic, p.ih, p.iw };
+            dst_dims = { p.mb, p.oc, fft_oh(p), fft_ow(p) };
+            wei_dims = with_groups
+                ? memory::dims{ p.g, OC, IC, p.kh, p.kw }
+                : memory::dims{ p.oc, p.ic, p.kh, p.kw };
+            strides = { 1, 1 };
+            padding = { p.pad, p.pad };
+            data_fmt = memory::format::nchw;
+            wei_fmt = with_groups
+                ? memory::format::goihw : memory::format::oihw;
+        }
+        bia_dims = { p.oc };
+    }
+
+    void TestForward() {
+        auto pd = fwd_pd();
+        auto src = filled(src_dims, data_fmt);
+        auto wei = filled(wei_dims, wei_fmt);
+        auto bia = filled(bia_dims, memory::format::x);
+        auto dst = memory({ md(dst_dims, data_fmt), eng });
+
+        std::vector<primitive> pipeline;
+        pipeline.push_back(convolution_forward(pd, src, wei, bia, dst));
+        stream(stream::kind::eager).submit(pipeline).wait();
+
+        std::vector<float> ref((size_t)p.mb * p.oc * fft_oh(p) * fft_ow(p));
+        compute_ref_fwd(p, (const float *)src.get_data_handle(),
+                (const float *)wei.get_data_handle(),
+                (const float *)bia.get_data_handle(), ref.data());
+        compare(ref, (const float *)dst.get_data_handle());
+    }
+
+    void TestBackwardData() {
+        auto bwd_d_desc = convolution_backward_data::desc(
+                algorithm::convolution_fft, md(src_dims, data_fmt),
+                md(wei_dims, wei_fmt), md(dst_dims, data_fmt), strides,
+                padding, padding, padding_kind::zero);
+        auto bwd_d_pd = convolution_backward_data::primitive_desc(bwd_d_desc,
+                eng, fwd_pd());
+
+        auto diff_dst = filled(dst_dims, data_fmt);
+        auto wei = filled(wei_dims, wei_fmt);
+        auto diff_src = memory({ md(src_dims, data_fmt), eng });
+
+        std::vector<primitive> pipeline;
+        pipeline.push_back(convolution_backward_data(bwd_d_pd, diff_dst,
+                    wei, diff_src));
+        stream(stream::kind::eager).submit(pipeline).wait();
+
+        std::vector<float> ref((size_t)p.mb * p.ic * fft_ih(p) * p.iw);
+        compute_ref_bwd_data(p, (const float *)diff_dst.get_data_handle(),
+                (const float *)wei.get_data_handle(), ref.data());
+        compare(ref, (const float *)diff_src.get_data_handle());
+    }
+
+    void TestBackwardWeights() {
+        auto bwd_w_desc = convolution_backward_weights::desc(
+                algorithm::convolution_fft, md(src_dims, data_fmt),
+                md(wei_dims, wei_fmt), md(bia_dims, memory::format::x),
+                md(dst_dims, data_fmt), strides, padding, padding,
+                padding_kind::zero);
+        auto bwd_w_pd = convolution_backward_weights::primitive_desc(
+                bwd_w_desc, eng, fwd_pd());
+
+        auto src = filled(src_dims, data_fmt);
+        auto diff_dst = filled(dst_dims, data_fmt);
+        auto diff_wei = memory({ md(wei_dims, wei_fmt), eng });
+        auto diff_bia = memory({ md(bia_dims, memory::format::x), eng });
+
+        std::vector<primitive> pipeline;
+        pipeline.push_back(convolution_backward_weights(bwd_w_pd, src,
+                    diff_dst, diff_wei, diff_bia));
+        stream(stream::kind::eager).submit(pipeline).wait();
+
+        std::vector<float> ref_wei((size_t)p.oc * (p.ic / p.g) * fft_kh(p)
+                * p.kw), ref_bia(p.oc);
+        compute_ref_bwd_weights(p, (const float *)src.get_data_handle(),
+                (const float *)diff_dst.get_data_handle(), ref_wei.data(),
+                ref_bia.data());
+        compare(ref_wei, (const float *)diff_wei.get_data_handle());
+        compare(ref_bia, (const float *)diff_bia.get_data_handle());
+    }
+};
+
+TEST_P(convolution_fft_test, TestForward) {
+    TestForward();
+}
+
+TEST_P(convolution_fft_test, TestBackwardData) {
+    TestBackwardData();
+}
+
+TEST_P(convolution_fft_test, TestBackwardWeights) {
+    TestBackwardWeights();
+}
+
+INSTANTIATE_TEST_CASE_P(TestConvolutionFFT, convolution_fft_test,
+    ::testing::Values(
+        fft_test_params{ 2, 1, 16, 32, 27, 27, 5, 5, 2 },
+        fft_test_params{ 1, 1, 3, 10, 40, 33, 7, 7, 3 },
+        fft_test_params{ 2, 2, 16, 24, 13, 17, 5, 5, 1 },
+        fft_test_params{ 1, 1, 3, 16, 35, 35, 11, 11, 0 },
+        fft_test_params{ 1, 1, 8, 8, 9, 9, 3, 3, 1 },
+        fft_test_params{ 1, 1, 12, 20, 17, 17, 7, 1, 3 },
+        fft_test_params{ 2, 1, 9, 16, 0, 100, 0, 16, 3 },
+        fft_test_params{ 1, 2, 8, 8, 0, 70, 0, 9, 0 }
+    ));
+
+}
@@ -0,0 +1,281 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+/* 3x3 winograd convolutions with stride 1 on nChw8c tensors (the avx512
+ * implementations need nChw16c, so these run the avx2 one) */
+struct winograd_test_params {
+    int mb, ic, oc, ih, iw, pad;
+};
+
+static int wino_oh(const winograd_test_params &p)
+{ return p.ih + 2 * p.pad - 2; }
+static int wino_ow(const winograd_test_params &p)
+{ return p.iw + 2 * p.pad - 2; }
+
+static void compute_ref_fwd(const winograd_test_params &p, const float *src,
+        const float *wei, const float *bias, float *dst) {
+    const int oh = wino_oh(p), ow = wino_ow(p);
+    mkldnn::impl::parallel_nd(p.mb, p.oc, oh, ow,
+        [&](int n, int oc, int y, int x) {
+        float a = bias[oc];
+        for (int ic = 0; ic < p.ic; ++ic)
+        for (int kh = 0; kh < 3; ++kh)
+        for (int kw = 0; kw < 3; ++kw) {
+            const int ih = y - p.pad + kh, iw = x - p.pad + kw;
+            if (ih < 0 || ih >= p.ih || iw < 0 || iw >= p.iw) continue;
+            a += src[((n * p.ic + ic) * p.ih + ih) * p.iw + iw]
+                * wei[((oc * p.ic + ic) * 3 + kh) * 3 + kw];
+        }
+        dst[((n * p.oc + oc) * oh + y) * ow + x] = a;
+    });
+}
+
+static void compute_ref_bwd_data(const winograd_test_params &p,
+        const float *diff_dst, const float *wei, float *diff_src) {
+    const int oh = wino_oh(p), ow = wino_ow(p);
+    mkldnn::impl::parallel_nd(p.mb, p.ic, p.ih, p.iw,
+        [&](int n, int ic, int ih, int iw) {
+        float a = 0.f;
+        for (int oc = 0; oc < p.oc; ++oc)
+        for (int kh = 0; kh < 3; ++kh)
+        for (int kw = 0; kw < 3; ++kw) {
+            const int y = ih + p.pad - kh, x = iw + p.pad - kw;
+            if (y < 0 || y >= oh || x < 0 || x >= ow) continue;
+            a += diff_dst[((n * p.oc + oc) * oh + y) * ow + x]
+                * wei[((oc * p.ic + ic) * 3 + kh) * 3 + kw];
+        }
+        diff_src[((n * p.ic + ic) * p.ih + ih) * p.iw + iw] = a;
+    });
+}
+
+static void compute_ref_bwd_weights(const winograd_test_params &p,
+        const float *src, const float *diff_dst, float *diff_wei,
+        float *diff_bias) {
+    const int oh = wino_oh(p), ow = wino_ow(p);
+    mkldnn::impl::parallel_nd(p.oc, p.ic, 3, 3,
+        [&](int oc, int ic, int kh, int kw) {
+        float a = 0.f;
+        for (int n = 0; n < p.mb; ++n)
+        for (int y = 0; y < oh; ++y)
+        for (int x = 0; x < ow; ++x) {
+            const int ih = y - p.pad + kh, iw = x - p.pad + kw;
+            if (ih < 0 || ih >= p.ih || iw < 0 || iw >= p.iw) continue;
+            a += diff_dst[((n * p.oc + oc) * oh + y) * ow + x]
+                * src[((n * p.ic + ic) * p.ih + ih) * p.iw + iw];
+        }
+        diff_wei[((oc * p.ic + ic) * 3 + kh) * 3 + kw] = a;
+    });
+    mkldnn::impl::parallel_nd(p.oc, [&](int oc) {
+        float a = 0.f;
+        for (int n = 0; n < p.mb; ++n)
+        for (int i = 0; i < oh * ow; ++i)
+            a += diff_dst[(n * p.oc + oc) * oh * ow + i];
+        diff_bias[oc] = a;
+    });
+}
+
+static void compare(const std::vector<float> &ref, const float *out) {
+    /* winograd trades some precision for the speed */
+    for (size_t i = 0; i < ref.size(); ++i) {
+        const float e = std::fabs(out[i] - ref[i])
+            / std::max(1.f, std::fabs(ref[i]));
+        ASSERT_LE(e, 5e-4f) << "at " << i;
+    }
+}
+
+class convolution_winograd_test
+    : public ::testing::TestWithParam<winograd_test_params> {
+protected:
+    winograd_test_params p;
+    engine eng = engine(engine::kind::cpu, 0);
+    memory::dims src_dims, wei_dims, bia_dims, dst_dims;
+    std::shared_ptr<convolution_forward::primitive_desc> fwd_pd;
+
+    memory::desc md(const memory::dims &dims, memory::format fmt) {
+        return memory::desc(dims, memory::data_type::f32, fmt);
+    }
+
+    memory plain(const memory::dims &dims, memory::format fmt) {
+        auto m = memory({ md(dims, fmt), eng });
+        fill_data<float>(m.get_primitive_desc().get_size() / sizeof(float),
+                (float *)m.get_data_handle(), 1., true);
+        return m;
+    }
+
+    convolution_forward::desc fwd_desc(prop_kind pk, memory::format wei_fmt) {
+        return convolution_forward::desc(pk, algorithm::convolution_winograd,
+                md(src_dims, memory::format::nChw8c), md(wei_dims, wei_fmt),
+                md(bia_dims, memory::format::x),
+                md(dst_dims, memory::format::nChw8c), { 1, 1 },
+                { p.pad, p.pad }, { p.pad, p.pad }, padding_kind::zero);
+    }
+
+    /* returns false if there is no avx2 winograd on this machine */
+    bool create_fwd_pd(prop_kind pk, memory::format wei_fmt) {
+        try {
+            fwd_pd.reset(new convolution_forward::primitive_desc(
+                        fwd_desc(pk, wei_fmt), eng));
+        } catch (error &e) {
+            if (e.status == mkldnn_unimplemented) return false;
+            throw;
+        }
+        return true;
+    }
+
+    virtual void SetUp() {
+        p = ::testing::TestWithParam<winograd_test_params>::GetParam();
+        src_dims = { p.mb, p.ic, p.ih, p.iw };
+        wei_dims = { p.oc, p.ic, 3, 3 };
+        bia_dims = { p.oc };
+        dst_dims = { p.mb, p.oc, wino_oh(p), wino_ow(p) };
+    }
+
+    void TestForward(prop_kind pk, memory::format wei_fmt) {
+        if (!create_fwd_pd(pk, wei_fmt)) return;
+
+        auto src = plain(src_dims, memory::format::nchw);
+        auto wei = plain(wei_dims, memory::format::oihw);
+        auto bia = plain(bia_dims, memory::format::x);
+        auto dst = memory({ md(dst_dims, memory::format::nchw), eng });
+
+        auto c_src = memory(fwd_pd->src_primitive_desc());
+        auto c_wei = memory(fwd_pd->weights_primitive_desc());
+        auto c_dst = memory(fwd_pd->dst_primitive_desc());
+
+        std::vector<primitive> pipeline;
+        pipeline.push_back(reorder(src, c_src));
+        pipeline.push_back(reorder(wei, c_wei));
+        pipeline.push_back(convolution_forward(*fwd_pd, c_src, c_wei, bia,
+                    c_dst));
+        pipeline.push_back(reorder(c_dst, dst));
+        stream(stream::kind::eager).submit(pipeline).wait();
+
+        std::vector<float> ref((size_t)p.mb * p.oc * wino_oh(p) * wino_ow(p));
+        compute_ref_fwd(p, (const float *)src.get_data_handle(),
+                (const float *)wei.get_data_handle(),
+                (const float *)bia.get_data_handle(), ref.data());
+        compare(ref, (const float *)dst.get_data_handle());
+    }
+
+    void TestBackwardData() {
+        if (!create_fwd_pd(prop_kind::forward_training,
+                    memory::format::oihw))
+            return;
+        auto bwd_d_desc = convolution_backward_data::desc(
+                algorithm::convolution_winograd,
+                md(src_dims, memory::format::nChw8c),
+                md(wei_dims, memory::format::oihw),
+                md(dst_dims, memory::format::nChw8c), { 1, 1 },
+                { p.pad, p.pad }, { p.pad, p.pad }, padding_kind::zero);
+        auto bwd_d_pd = convolution_backward_data::primitive_desc(bwd_d_desc,
+                eng, *fwd_pd);
+
+        auto diff_dst = plain(dst_dims, memory::format::nchw);
+        auto wei = plain(wei_dims, memory::format::oihw);
+        auto diff_src = memory({ md(src_dims, memory::format::nchw), eng });
+
+        auto c_diff_dst = memory(bwd_d_pd.diff_dst_primitive_desc());
+        auto c_diff_src = memory(bwd_d_pd.diff_src_primitive_desc());
+
+        std::vector<primitive> pipeline;
+        pipeline.push_back(reorder(diff_dst, c_diff_dst));
+        pipeline.push_back(convolution_backward_data(bwd_d_pd, c_diff_dst,
+                    wei, c_diff_src));
+        pipeline.push_back(reorder(c_diff_src, diff_src));
+        stream(stream::kind::eager).submit(pipeline).wait();
+
+        std::vector<float> ref((size_t)p.mb * p.ic * p.ih * p.iw);
+        compute_ref_bwd_data(p, (const float *)diff_dst.get_data_handle(),
+                (const float *)wei.get_data_handle(), ref.data());
+        compare(ref, (const float *)diff_src.get_data_handle());
+    }
+
+    void TestBackwardWeights() {
+        if (!create_fwd_pd(prop_kind::forward_training,
+                    memory::format::oihw))
+            return;
+        auto bwd_w_desc = convolution_backward_weights::desc(
+                algorithm::convolution_winograd,
+                md(src_dims, memory::format::nChw8c),
+                md(wei_dims, memory::format::oihw),
+                md(bia_dims, memory::format::x),
+                md(dst_dims, memory::format::nChw8c), { 1, 1 },
+                { p.pad, p.pad }, { p.pad, p.pad }, padding_kind::zero);
+        auto bwd_w_pd = convolution_backward_weights::primitive_desc(
+                bwd_w_desc, eng, *fwd_pd);
+
+        auto src = plain(src_dims, memory::format::nchw);
+        auto diff_dst = plain(dst_dims, memory::format::nchw);
+        auto diff_wei = memory({ md(wei_dims, memory::format::oihw), eng });
+        auto diff_bia = memory({ md(bia_dims, memory::format::x), eng });
+
+        auto c_src = memory(bwd_w_pd.src_primitive_desc());
+        auto c_diff_dst = memory(bwd_w_pd.diff_dst_primitive_desc());
+
+        std::vector<primitive> pipeline;
+        pipeline.push_back(reorder(src, c_src));
+        pipeline.push_back(reorder(diff_dst, c_diff_dst));
+        pipeline.push_back(convolution_backward_weights(bwd_w_pd, c_src,
+                    c_diff_dst, diff_wei, diff_bia));
+        stream(stream::kind::eager).submit(pipeline).wait();
+
+        std::vector<float> ref_wei((size_t)p.oc * p.ic * 9), ref_bia(p.oc);
+        compute_ref_bwd_weights(p, (const float *)src.get_data_handle(),
+                (const float *)diff_dst.get_data_handle(), ref_wei.data(),
+                ref_bia.data());
+        compare(ref_wei, (const float *)diff_wei.get_data_handle());
+        compare(ref_bia, (const float *)diff_bia.get_data_handle());
+    }
+};
+
+TEST_P(convolution_winograd_test, TestForwardTraining) {
+    TestForward(prop_kind::forward_training, memory::format::oihw);
+}
+
+TEST_P(convolution_winograd_test, TestForwardInference) {
+    /* weights come pre-transformed by the wino_fmt reorder */
+    TestForward(prop_kind::forward_inference, memory::format::any);
+}
+
+TEST_P(convolution_winograd_test, TestBackwardData) {
+    TestBackwardData();
+}
+
+TEST_P(convolution_winograd_test, TestBackwardWeights) {
+    TestBackwardWeights();
+}
+
+INSTANTIATE_TEST_CASE_P(TestConvolutionWinograd, convolution_winograd_test,
+    ::testing::Values(
+        winograd_test_params{ 2, 16, 32, 14, 14, 1 },
+        winograd_test_params{ 1, 3, 5, 13, 13, 1 },
+        winograd_test_params{ 2, 24, 40, 7, 9, 1 },
+        winograd_test_params{ 1, 64, 64, 28, 28, 1 },
+        winograd_test_params{ 3, 17, 9, 6, 6, 0 },
+        winograd_test_params{ 1, 32, 48, 12, 12, 2 },
+        winograd_test_params{ 1, 8, 8, 3, 3, 1 }
+    ));
+
+}
@@ -140,4 +140,107 @@ INSTANTIATE_TEST_CASE_P(TestSGEMM, sgemm_test, ::testing::Values(
     test_params{'t', 't', 2000, 2000, 2000, 1.0, 0.0, 2000, 2000, 2000, false},
     test_params{'t', 't', 3000, 3000, 3000, 1.0, 0.0, 3000, 3000, 3000, false}
 ));
+
+INSTANTIATE_TEST_CASE_P(TestSGEMMSmall, sgemm_test, ::testing::Values(
+    test_params{'n', 'n', 63, 63, 63, 1.0, 0.0, 63, 63, 63, false},
+    test_params{'n', 't', 63, 63, 63, 1.0, 0.0, 64, 64, 64, false},
+    test_params{'n', 'n', 17, 5, 1, 0.5, 1.5, 20, 3, 19, false},
+    test_params{'n', 't', 1, 63, 40, 2.0, 0.0, 1, 63, 1, false},
+    test_params{'n', 'n', 40, 3, 63, 1.0, 2.0, 41, 64, 40, false},
+    test_params{'n', 't', 33, 9, 7, 1.0, 1.0, 33, 9, 33, false},
+    test_params{'t', 'n', 16, 16, 16, 1.0, 0.0, 16, 16, 16, false}
+));
+
+class sgemm_pack_test: public ::testing::TestWithParam<test_params> {
+protected:
+    virtual void SetUp() {
+        test_params p
+            = ::testing::TestWithParam<test_params>::GetParam();
+        catch_expected_failures([=](){Test();}, p.expect_to_fail,
+                    p.expected_status);
+    }
+    virtual void Test() {
+        mkldnn_status_t status;
+        test_params p
+            = ::testing::TestWithParam<test_params>::GetParam();
+        const bool tr_a = (p.transA == 'T' || p.transA == 't');
+        const bool tr_b = (p.transB == 'T' || p.transB == 't');
+        size_t sizeA = !tr_a ? p.lda * p.K : p.lda * p.M,
+                sizeB = !tr_b ? p.ldb * p.N : p.ldb * p.K,
+                sizeC = p.ldc * p.N;
+        float *A = (float *)test_malloc(sizeA*sizeof(float));
+        float *B = (float *)test_malloc(sizeB*sizeof(float));
+        float *C = (float *)test_malloc(sizeC*sizeof(float));
+        float *C_ref = (float *)test_malloc(sizeC*sizeof(float));
+
+        fill_data<float>(sizeA, A);
+        fill_data<float>(sizeB, B);
+        fill_data<float>(sizeC, C);
+
+        mkldnn::impl::parallel_nd(p.N * p.ldc, [&](int i) { C_ref[i] = C[i]; });
+
+        /* pack A only, then both A and B */
+        for (int pack_b = 0; pack_b < 2; ++pack_b) {
+            size_t sz_a = 0, sz_b = 0;
+            status = mkldnn_sgemm_pack_get_size("A", &p.transA, &p.transB,
+                    &p.M, &p.N, &p.K, &sz_a);
+            if (status != mkldnn_success)
+                throw error(status, "mkldnn_sgemm_pack_get_size failed");
+            status = mkldnn_sgemm_pack_get_size("B", &p.transA, &p.transB,
+                    &p.M, &p.N, &p.K, &sz_b);
+            if (status != mkldnn_success)
+                throw error(status, "mkldnn_sgemm_pack_get_size failed");
+
+            float *A_packed = (float *)test_malloc(sz_a);
+            float *B_packed = (float *)test_malloc(sz_b);
+            const float one = 1.0f;
+
+            status = mkldnn_sgemm_pack("A", &p.transA, &p.transB, &p.M,
+                    &p.N, &p.K, &p.alpha, A, &p.lda, A_packed);
+            if (status != mkldnn_success)
+                throw error(status, "mkldnn_sgemm_pack failed");
+            status = mkldnn_sgemm_pack("B", &p.transA, &p.transB, &p.M,
+                    &p.N, &p.K, &one, B, &p.ldb, B_packed);
+            if (status != mkldnn_success)
+                throw error(status, "mkldnn_sgemm_pack failed");
+
+            float *C_cur = (float *)test_malloc(sizeC*sizeof(float));
+            mkldnn::impl::parallel_nd(p.N * p.ldc,
+                    [&](int i) { C_cur[i] = C[i]; });
+            mkldnn::impl::parallel_nd(p.N * p.ldc,
+                    [&](int i) { C_ref[i] = C[i]; });
+
+            status = mkldnn_sgemm_compute("P", pack_b ? "P" : &p.transB,
+                    &p.M, &p.N, &p.K, A_packed, &p.lda,
+                    pack_b ? B_packed : B, &p.ldb, &p.beta, C_cur, &p.ldc);
+            if (status != mkldnn_success)
+                throw error(status, "mkldnn_sgemm_compute failed");
+
+            ref_gemm(&p.transA, &p.transB, p.M, p.N, p.K, p.alpha, A, p.lda,
+                    B, p.ldb, p.beta, C_ref, p.ldc);
+            compare(p.M, p.N, p.ldc, C_cur, C_ref);
+
+            test_free((char *)C_cur);
+            test_free((char *)A_packed);
+            test_free((char *)B_packed);
+        }
+
+        test_free((char *)A);
+        test_free((char *)B);
+        test_free((char *)C);
+        test_free((char *)C_ref);
+    }
+};
+TEST_P(sgemm_pack_test, TestSGEMMPack) {}
+INSTANTIATE_TEST_CASE_P(TestSGEMMPack, sgemm_pack_test, ::testing::Values(
+    test_params{'n', 't', 3, 2, 1, 1.0, 0.0, 3, 1, 8, true, mkldnn_invalid_arguments},
+
+    test_params{'N', 'n', 30, 20, 10, 2.0, 1.0, 60, 50, 80, false},
+    test_params{'n', 'T', 30, 20, 10, 2.0, 1.0, 60, 50, 80, false},
+    test_params{'T', 'N', 30, 20, 10, 2.0, 1.0, 60, 50, 80, false},
+    test_params{'t', 't', 30, 20, 10, 2.0, 1.0, 60, 50, 80, false},
+    test_params{'n', 'n', 100, 100, 2, 1.0, 2.0, 100, 100, 100, false},
+    test_params{'t', 'n', 1024, 64, 256, 1.0, 0.0, 256, 256, 1024, false},
+    test_params{'n', 'n', 2, 2, 10000, 1.0, 2.0, 2, 10000, 2, false}
+));
 }
@@ -84,4 +84,36 @@ TEST(pd_next_impl, TestEltwiseImpl) {
     }
 }
 
+TEST(pd_estimates, TestConvolutionAndPooling) {
+    auto eng = engine(engine::kind::cpu, 0);
+    memory::desc src({2, 16, 14, 14}, memory::data_type::f32,
+            memory::format::any);
+    memory::desc wei({32, 16, 3, 3}, memory::data_type::f32,
+            memory::format::any);
+    memory::desc dst({2, 32, 14, 14}, memory::data_type::f32,
+            memory::format::any);
+
+    convolution_forward::desc cd(prop_kind::forward_training,
+            algorithm::convolution_direct, src, wei, dst,
+            {1, 1}, {1, 1}, {1, 1}, padding_kind::zero);
+    convolution_forward::primitive_desc cpd(cd, eng);
+    do {
+        EXPECT_GT(cpd.time_estimate(), 0.);
+        EXPECT_GE(cpd.memory_consumption(), 0);
+    } while (cpd.next_impl());
+
+    /* the workspace of max pooling is part of the extra memory */
+    memory::desc psrc({2, 16, 14, 14}, memory::data_type::f32,
+            memory::format::nchw);
+    memory::desc pdst({2, 16, 7, 7}, memory::data_type::f32,
+            memory::format::any);
+    pooling_forward::desc pd(prop_kind::forward_training,
+            algorithm::pooling_max, psrc, pdst, {2, 2}, {2, 2}, {0, 0},
+            {0, 0}, padding_kind::zero);
+    pooling_forward::primitive_desc ppd(pd, eng);
+    EXPECT_GT(ppd.time_estimate(), 0.);
+    EXPECT_GE(ppd.memory_consumption(),
+            (ptrdiff_t)ppd.workspace_primitive_desc().get_size());
+}
+
 }
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <fstream>
+#include <string>
+
+#include "mkldnn_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "mkldnn.hpp"
+
+namespace mkldnn {
+
+static const char *tune_db = "test_iface_tuning.db";
+
+/* the library reads the environment once, so set it up before any test */
+static struct tuning_env_t {
+    tuning_env_t() {
+        remove(tune_db);
+#ifdef _WIN32
+        _putenv_s("MKLDNN_TUNE", "1");
+        _putenv_s("MKLDNN_TUNE_DB", tune_db);
+#else
+        setenv("MKLDNN_TUNE", "1", 1);
+        setenv("MKLDNN_TUNE_DB", tune_db, 1);
+#endif
+    }
+} tuning_env;
+
+static int db_lines() {
+    std::ifstream f(tune_db);
+    std::string line;
+    int n = 0;
+    while (std::getline(f, line)) ++n;
+    return n;
+}
+
+TEST(iface_tuning, TestConvolutionImpls) {
+    auto eng = engine(engine::kind::cpu, 0);
+    memory::desc src({2, 32, 14, 14}, memory::data_type::f32,
+            memory::format::any);
+    memory::desc wei({64, 32, 1, 1}, memory::data_type::f32,
+            memory::format::any);
+    memory::desc dst({2, 64, 14, 14}, memory::data_type::f32,
+            memory::format::any);
+
+    convolution_forward::desc cd(prop_kind::forward_training,
+            algorithm::convolution_direct, src, wei, dst,
+            {1, 1}, {0, 0}, {0, 0}, padding_kind::zero);
+
+    convolution_forward::primitive_desc cpd0(cd, eng);
+    std::string impl(cpd0.impl_info_str());
+    const int n = db_lines();
+
+    /* the choice is remembered, so the same problem is not timed again */
+    convolution_forward::primitive_desc cpd1(cd, eng);
+    EXPECT_EQ(impl, std::string(cpd1.impl_info_str()));
+    EXPECT_EQ(n, db_lines());
+
+    /* the remaining implementations are still reachable, each once */
+    int nimpls = 1;
+    while (cpd1.next_impl()) {
+        EXPECT_NE(impl, std::string(cpd1.impl_info_str()));
+        ++nimpls;
+    }
+    EXPECT_GE(nimpls, 2);
+}
+
+}
@@ -31,6 +31,7 @@ struct test_lrn_desc_t {
     float alpha, beta, k;
     int local_size;
     int kind; // 0 ac, 1 wc
+    int d; // 0 for 2D data
 };
 
 struct lrn_test_params {
@@ -50,8 +51,9 @@ void check_lrn_fwd(const lrn_test_params &p, const memory &src, const memory &ds
     data_t *src_ptr = (data_t *)src.get_data_handle();
     data_t *dst_ptr = (data_t *)dst.get_data_handle();
 
+    // the spatial dims of 3D data are checked as 2D ones, d * h by w
     const int C = p.test_ld.c;
-    const int H = p.test_ld.h;
+    const int H = p.test_ld.d ? p.test_ld.d * p.test_ld.h : p.test_ld.h;
     const int W = p.test_ld.w;
     const int size = p.test_ld.local_size;
     const int CSIZE = p.test_ld.kind == ACROSS ? size : 1;
@@ -64,7 +66,7 @@ void check_lrn_fwd(const lrn_test_params &p, const memory &src, const memory &ds
 
     auto off = [=](int n, int c, int h, int w)
     {
-        return ((n * padded_c + c) * p.test_ld.h + h) * p.test_ld.w + w;
+        return ((n * padded_c + c) * H + h) * W + w;
     };
 
     auto ker = [=](data_t *d, int n, int oc, int oh, int ow)
@@ -112,7 +114,7 @@ void check_lrn_bwd(const lrn_test_params &p, const memory &src,
 
     const int MB = p.test_ld.mb;
     const int C = p.test_ld.c;
-    const int H = p.test_ld.h;
+    const int H = p.test_ld.d ? p.test_ld.d * p.test_ld.h : p.test_ld.h;
     const int W = p.test_ld.w;
     const int local_size = p.test_ld.local_size;
     size_t padded_c = src.get_primitive_desc().desc().data.layout_desc.blocking.padding_dims[1];
@@ -223,14 +225,15 @@ protected:
 
         test_lrn_desc_t ld = p.test_ld;
 
-        src_desc.reset(new memory::desc({ ld.mb, ld.c, ld.h, ld.w },
-                data_type, p.data_format));
-        dst_desc.reset(new memory::desc({ ld.mb, ld.c, ld.h, ld.w },
-                data_type, p.data_format));
-        diff_src_desc.reset(new memory::desc({ ld.mb, ld.c, ld.h, ld.w },
-                data_type, p.diff_data_format));
-        diff_dst_desc.reset(new memory::desc({ ld.mb, ld.c, ld.h, ld.w },
-                data_type, p.diff_data_format));
+        memory::dims dims = ld.d
+            ? memory::dims({ ld.mb, ld.c, ld.d, ld.h, ld.w })
+            : memory::dims({ ld.mb, ld.c, ld.h, ld.w });
+        src_desc.reset(new memory::desc(dims, data_type, p.data_format));
+        dst_desc.reset(new memory::desc(dims, data_type, p.data_format));
+        diff_src_desc.reset(new memory::desc(dims, data_type,
+                p.diff_data_format));
+        diff_dst_desc.reset(new memory::desc(dims, data_type,
+                p.diff_data_format));
 
         is_training = p.aprop_kind == prop_kind::forward_training;
 
@@ -385,6 +388,44 @@ INSTANTIATE_TEST_CASE_P(TestLRNBackward_nChw8c_padded, lrn_test_float,
             memory::format::nChw8c, { 2, 12, 4, 4, 1.0e-4f, 0.75f, 5.7f, 5, ACROSS } }
             ));
 
+INSTANTIATE_TEST_CASE_P(TestLRNAnySizeAnyBeta, lrn_test_float,
+        ::testing::Values(
+            lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nchw,
+            memory::format::nchw, { 2, 10, 4, 5, 1.0e-4f, 0.75f, 1.0f, 3, ACROSS } }
+            , lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nhwc,
+            memory::format::nhwc, { 2, 17, 4, 5, 1.0e-2f, 1.0f, 2.0f, 7, ACROSS } }
+            , lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nChw8c,
+            memory::format::nChw8c, { 2, 26, 4, 5, 1.0e-2f, 0.6f, 1.0f, 9, ACROSS } }
+            , lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nChw16c,
+            memory::format::nChw16c, { 2, 32, 6, 7, 1.0e-2f, 0.5f, 1.0f, 5, ACROSS } }
+            , lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nChw16c,
+            memory::format::nChw16c, { 2, 17, 6, 7, 1.0e-4f, 0.75f, 1.0f, 3, ACROSS } }
+            , lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nchw,
+            memory::format::nchw, { 2, 3, 4, 5, 1.0e-4f, 0.75f, 1.0f, 9, ACROSS } }
+            ));
+
+INSTANTIATE_TEST_CASE_P(TestLRN3D, lrn_test_float,
+        ::testing::Values(
+            lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::ncdhw,
+            memory::format::ncdhw, { 2, 10, 4, 5, 1.0e-4f, 0.75f, 1.0f, 5, ACROSS, 3 } }
+            , lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::ndhwc,
+            memory::format::ndhwc, { 2, 10, 4, 5, 1.0e-4f, 0.75f, 1.0f, 3, ACROSS, 3 } }
+            , lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nCdhw8c,
+            memory::format::nCdhw8c, { 2, 12, 4, 5, 1.0e-2f, 1.0f, 2.0f, 5, ACROSS, 2 } }
+            , lrn_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nCdhw16c,
+            memory::format::nCdhw16c, { 2, 19, 4, 5, 1.0e-4f, 0.75f, 1.0f, 5, ACROSS, 3 } }
+            ));
+
 INSTANTIATE_TEST_CASE_P(TestLRN, lrn_test_float,
         ::testing::Values(
             lrn_test_params_float{ prop_kind::forward_training,
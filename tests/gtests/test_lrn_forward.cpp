@@ -31,6 +31,7 @@ struct test_lrn_desc_t {
     float alpha, beta, k;
     int local_size;
     int kind; // 0 ac, 1 wc
+    int d; // 0 for 2D data
 };
 
 template <typename data_t>
@@ -41,8 +42,9 @@ void check_lrn_fwd(const test_lrn_desc_t &ld,
     data_t *src_ptr = (data_t *)src.get_data_handle();
     data_t *dst_ptr = (data_t *)dst.get_data_handle();
 
+    // the spatial dims of 3D data are checked as 2D ones, d * h by w
     const int C = ld.c;
-    const int H = ld.h;
+    const int H = ld.d ? ld.d * ld.h : ld.h;
     const int W = ld.w;
     const int size = ld.local_size;
     const int CSIZE = ld.kind == ACROSS ? size : 1;
@@ -52,7 +54,7 @@ void check_lrn_fwd(const test_lrn_desc_t &ld,
 
     auto off = [=](int n, int c, int h, int w)
     {
-        return ((n * padded_c + c) * ld.h + h) * ld.w + w;
+        return ((n * padded_c + c) * H + h) * W + w;
     };
 
     auto ker = [=](data_t *d, int n, int oc, int oh, int ow)
@@ -122,10 +124,11 @@ protected:
         test_lrn_desc_t ld = p.test_ld;
         bool with_workspace = p.aprop_kind == prop_kind::forward_training;
 
-        auto l_src_desc = create_md({ ld.mb, ld.c, ld.h, ld.w },
-                data_type, p.src_format);
-        auto l_dst_desc = create_md({ ld.mb, ld.c, ld.h, ld.w },
-                data_type, p.dst_format);
+        memory::dims dims = ld.d
+            ? memory::dims({ ld.mb, ld.c, ld.d, ld.h, ld.w })
+            : memory::dims({ ld.mb, ld.c, ld.h, ld.w });
+        auto l_src_desc = create_md(dims, data_type, p.src_format);
+        auto l_dst_desc = create_md(dims, data_type, p.dst_format);
 
         auto l_src = test_memory(l_src_desc, eng);
         auto l_dst = test_memory(l_dst_desc, eng);
@@ -233,6 +236,44 @@ INSTANTIATE_TEST_CASE_P(TestLRNForward_nChw8c_padded, lrn_forward_test_float,
             memory::format::nChw8c, { 2, 12, 4, 4, 1.0e-4f, 0.75f, 5.7f, 5, ACROSS } }
             ));
 
+INSTANTIATE_TEST_CASE_P(TestLRNForwardAnySizeAnyBeta, lrn_forward_test_float,
+        ::testing::Values(
+            lrn_fwd_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nchw,
+            memory::format::nchw, { 2, 10, 4, 5, 1.0e-4f, 0.75f, 1.0f, 3, ACROSS } }
+            , lrn_fwd_test_params_float{ prop_kind::forward_scoring,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nhwc,
+            memory::format::nhwc, { 2, 17, 4, 5, 1.0e-4f, 1.0f, 2.0f, 7, ACROSS } }
+            , lrn_fwd_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nChw8c,
+            memory::format::nChw8c, { 2, 26, 4, 5, 1.0e-4f, 0.6f, 1.0f, 9, ACROSS } }
+            , lrn_fwd_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nChw16c,
+            memory::format::nChw16c, { 2, 32, 6, 7, 1.0e-4f, 0.5f, 1.0f, 5, ACROSS } }
+            , lrn_fwd_test_params_float{ prop_kind::forward_scoring,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nChw16c,
+            memory::format::nChw16c, { 2, 17, 6, 7, 1.0e-4f, 0.75f, 1.0f, 3, ACROSS } }
+            , lrn_fwd_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nchw,
+            memory::format::nchw, { 2, 3, 4, 5, 1.0e-4f, 0.75f, 1.0f, 9, ACROSS } }
+            ));
+
+INSTANTIATE_TEST_CASE_P(TestLRNForward3D, lrn_forward_test_float,
+        ::testing::Values(
+            lrn_fwd_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::ncdhw,
+            memory::format::ncdhw, { 2, 10, 4, 5, 1.0e-4f, 0.75f, 1.0f, 5, ACROSS, 3 } }
+            , lrn_fwd_test_params_float{ prop_kind::forward_scoring,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::ndhwc,
+            memory::format::ndhwc, { 2, 10, 4, 5, 1.0e-4f, 0.75f, 1.0f, 3, ACROSS, 3 } }
+            , lrn_fwd_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nCdhw8c,
+            memory::format::nCdhw8c, { 2, 12, 4, 5, 1.0e-4f, 1.0f, 2.0f, 5, ACROSS, 2 } }
+            , lrn_fwd_test_params_float{ prop_kind::forward_training,
+            engine::kind::cpu, algorithm::lrn_across_channels, memory::format::nCdhw16c,
+            memory::format::nCdhw16c, { 2, 19, 4, 5, 1.0e-4f, 0.75f, 1.0f, 5, ACROSS, 3 } }
+            ));
+
 INSTANTIATE_TEST_CASE_P(TestLRNForward, lrn_forward_test_float,
         ::testing::Values(
             lrn_fwd_test_params_float{ prop_kind::forward_training,
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <utility>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -160,18 +161,29 @@ TEST_P(test_for_nd_with_diff_types, Test) {
 }
 INSTANTIATE_TEST_CASE_P(Case0, test_for_nd_with_diff_types, ::testing::Values(np_t{{4, 9}}));
 
+/* the static and the dynamic schedules of parallel_nd */
+struct static_nd_t {
+    template <typename ...Args> static void run(Args &&...args)
+    { impl::parallel_nd(std::forward<Args>(args)...); }
+};
+struct dynamic_nd_t {
+    template <typename ...Args> static void run(Args &&...args)
+    { impl::parallel_nd_dynamic(std::forward<Args>(args)...); }
+};
+
 class test_parallel_nd: public test_nd {
 protected:
+    template <typename schedule_t>
     void emit_parallel_nd() {
         switch ((int)p.dims.size()) {
         case 1:
-            impl::parallel_nd(p.dims[0], [&](ptrdiff_t d0) {
+            schedule_t::run(p.dims[0], [&](ptrdiff_t d0) {
                 ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
                 data[d0] = d0;
             });
             break;
         case 2:
-            impl::parallel_nd(p.dims[0], p.dims[1], [&](ptrdiff_t d0, ptrdiff_t d1) {
+            schedule_t::run(p.dims[0], p.dims[1], [&](ptrdiff_t d0, ptrdiff_t d1) {
                 ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
                 ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
                 const ptrdiff_t idx = d0 * p.dims[1] + d1;
@@ -179,7 +191,7 @@ protected:
             });
             break;
         case 3:
-            impl::parallel_nd(p.dims[0], p.dims[1], p.dims[2], [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2) {
+            schedule_t::run(p.dims[0], p.dims[1], p.dims[2], [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2) {
                 ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
                 ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
                 ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
@@ -188,7 +200,7 @@ protected:
             });
             break;
         case 4:
-            impl::parallel_nd(p.dims[0], p.dims[1], p.dims[2], p.dims[3], [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2, ptrdiff_t d3) {
+            schedule_t::run(p.dims[0], p.dims[1], p.dims[2], p.dims[3], [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2, ptrdiff_t d3) {
                 ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
                 ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
                 ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
@@ -198,7 +210,7 @@ protected:
             });
             break;
         case 5:
-            impl::parallel_nd(p.dims[0], p.dims[1], p.dims[2], p.dims[3], p.dims[4], [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2, ptrdiff_t d3, ptrdiff_t d4) {
+            schedule_t::run(p.dims[0], p.dims[1], p.dims[2], p.dims[3], p.dims[4], [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2, ptrdiff_t d3, ptrdiff_t d4) {
                 ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
                 ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
                 ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
@@ -209,7 +221,7 @@ protected:
             });
             break;
         case 6:
-            impl::parallel_nd(p.dims[0], p.dims[1], p.dims[2], p.dims[3], p.dims[4], p.dims[5], [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2, ptrdiff_t d3, ptrdiff_t d4, ptrdiff_t d5) {
+            schedule_t::run(p.dims[0], p.dims[1], p.dims[2], p.dims[3], p.dims[4], p.dims[5], [&](ptrdiff_t d0, ptrdiff_t d1, ptrdiff_t d2, ptrdiff_t d3, ptrdiff_t d4, ptrdiff_t d5) {
                 ASSERT_TRUE(0 <= d0 && d0 < p.dims[0]);
                 ASSERT_TRUE(0 <= d1 && d1 < p.dims[1]);
                 ASSERT_TRUE(0 <= d2 && d2 < p.dims[2]);
@@ -227,17 +239,70 @@ protected:
 };
 
 TEST_P(test_parallel_nd, Test) {
-    emit_parallel_nd();
+    emit_parallel_nd<static_nd_t>();
+    CheckID();
+}
+
+TEST_P(test_parallel_nd, Dynamic) {
+    emit_parallel_nd<dynamic_nd_t>();
     CheckID();
 }
 
 INSTANTIATE_TEST_CASE_P(Case, test_parallel_nd, ::testing::Values(
-    np_t{{0}}, np_t{{1}}, np_t{{100}},
-    np_t{{0, 0}}, np_t{{1, 2}}, np_t{{10, 10}},
+    np_t{{0}}, np_t{{1}}, np_t{{100}}, np_t{{10007}},
+    np_t{{0, 0}}, np_t{{1, 2}}, np_t{{10, 10}}, np_t{{7, 1001}},
     np_t{{0, 1, 0}}, np_t{{1, 2, 1}}, np_t{{4, 4, 10}},
     np_t{{0, 3, 0, 1}}, np_t{{1, 1, 2, 1}}, np_t{{4, 4, 5, 2}},
     np_t{{3, 0, 3, 0, 1}}, np_t{{2, 1, 1, 2, 1}}, np_t{{4, 1, 4, 5, 2}},
     np_t{{4, 3, 0, 3, 0, 1}}, np_t{{2, 1, 3, 1, 2, 1}}, np_t{{4, 1, 4, 3, 2, 2}}
 ));
 
+
+/* an executor that runs the tasks on the calling thread and counts the
+ * parallel sections */
+struct counting_threadpool_t {
+    counting_threadpool_t(int nthr): nthr(nthr), sections(0) {
+        iface.ctx = this;
+        iface.get_num_threads = [](void *ctx)
+        { return ((counting_threadpool_t *)ctx)->nthr; };
+        iface.get_thread_num = [](void *) { return -1; };
+        iface.schedule = [](void *ctx, int n, void (*task)(void *, int),
+                void *task_arg) {
+            ((counting_threadpool_t *)ctx)->sections++;
+            for (int i = 0; i < n; ++i) task(task_arg, i);
+        };
+    }
+
+    int nthr;
+    int sections;
+    mkldnn_threadpool_t iface;
+};
+
+TEST(test_threadpool, StreamThreadpool) {
+    auto eng = engine(engine::kind::cpu, 0);
+    memory::desc md({2, 16, 8, 8}, memory::data_type::f32,
+            memory::format::nchw);
+    memory src({md, eng}), dst({md, eng});
+    auto *s = (float *)src.get_data_handle();
+    for (int i = 0; i < 2 * 16 * 8 * 8; ++i) s[i] = (float)(i % 7 - 3);
+
+    eltwise_forward::desc ed(prop_kind::forward_inference,
+            algorithm::eltwise_relu, md, 0.f);
+    eltwise_forward::primitive_desc epd(ed, eng);
+    eltwise_forward relu(epd, src, dst);
+
+    counting_threadpool_t tp(2);
+    stream strm(stream::kind::eager);
+    mkldnn_status_t st = mkldnn_stream_set_threadpool(strm.get(), &tp.iface);
+    if (st == mkldnn_unimplemented) return; /* not a THREADPOOL build */
+    ASSERT_EQ(st, mkldnn_success);
+
+    strm.submit({relu}).wait();
+    EXPECT_GT(tp.sections, 0);
+
+    const auto *d = (const float *)dst.get_data_handle();
+    for (int i = 0; i < 2 * 16 * 8 * 8; ++i)
+        EXPECT_EQ(d[i], s[i] > 0 ? s[i] : 0.f);
+}
+
 }
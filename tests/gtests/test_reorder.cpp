@@ -333,7 +333,11 @@ TEST_P(reorder_simple_test_weights_f32_f32_1, TestsReorder) { }
 INSTANTIATE_TEST_CASE_P(TestReorder, reorder_simple_test_weights_f32_f32_1,
         ::testing::Values(
             cfg_f32{eng::cpu, fmt::goihw, fmt::Goihw16g, {32, 32, 32, 3, 3}},
-            cfg_f32{eng::cpu, fmt::Goihw16g, fmt::goihw, {32, 32, 32, 3, 3}}
+            cfg_f32{eng::cpu, fmt::Goihw16g, fmt::goihw, {32, 32, 32, 3, 3}},
+            cfg_f32{eng::cpu, fmt::goidhw, fmt::Goidhw8g, {20, 1, 1, 3, 3, 3}},
+            cfg_f32{eng::cpu, fmt::Goidhw8g, fmt::goidhw, {20, 1, 1, 3, 3, 3}},
+            cfg_f32{eng::cpu, fmt::goidhw, fmt::Goidhw16g, {32, 1, 1, 3, 2, 3}},
+            cfg_f32{eng::cpu, fmt::Goidhw16g, fmt::goidhw, {32, 1, 1, 3, 2, 3}}
             )
         );
 
@@ -0,0 +1,175 @@
+/*******************************************************************************
+* Copyright 2018 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef TEST_THREADPOOL_HPP
+#define TEST_THREADPOOL_HPP
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "mkldnn.h"
+
+/* A simple executor for the tests of the library built with
+ * MKLDNN_THREADING=THREADPOOL: the calling thread and nthr - 1 workers take
+ * the tasks of a parallel section from a shared counter. The workers spin for
+ * a while between the sections before going to sleep, much like the OpenMP
+ * runtimes do, so that the timings can be compared. The workers are started
+ * on the first section only. */
+namespace test_threadpool {
+
+struct threadpool_t {
+    threadpool_t(int nthr): nthr_(nthr < 1 ? 1 : nthr), started_(false)
+        , stop_(false), generation_(0), task_(nullptr), task_arg_(nullptr)
+        , n_(0), next_(0), done_(0), active_(0) {
+        iface_.ctx = this;
+        iface_.get_num_threads = [](void *ctx)
+        { return ((threadpool_t *)ctx)->nthr_; };
+        iface_.get_thread_num = [](void *ctx) { return worker_index(ctx); };
+        iface_.schedule = [](void *ctx, int n, void (*task)(void *, int),
+                void *task_arg)
+        { ((threadpool_t *)ctx)->schedule(n, task, task_arg); };
+    }
+
+    ~threadpool_t() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+            ++generation_;
+        }
+        cv_.notify_all();
+        for (auto &w: workers_) w.join();
+    }
+
+    const mkldnn_threadpool_t *iface() const { return &iface_; }
+
+    void schedule(int n, void (*task)(void *, int), void *task_arg) {
+        /* the sections of concurrent callers run one after another */
+        std::lock_guard<std::mutex> section_lock(section_mutex_);
+        if (nthr_ == 1 || n == 1) {
+            for (int i = 0; i < n; ++i) task(task_arg, i);
+            return;
+        }
+        if (!started_) start();
+
+        {
+            /* a late worker may still look for the tasks of the previous
+             * section, wait for it to give up before the new one starts */
+            std::lock_guard<std::mutex> lock(mutex_);
+            while (active_.load(std::memory_order_acquire) != 0)
+                std::this_thread::yield();
+            task_ = task;
+            task_arg_ = task_arg;
+            n_ = n;
+            next_ = 0;
+            done_ = 0;
+            ++generation_;
+        }
+        cv_.notify_all();
+
+        run_tasks();
+        while (done_.load(std::memory_order_acquire) < n)
+            std::this_thread::yield();
+    }
+
+private:
+    /* the pool and the index of the calling worker thread */
+    struct worker_t { const void *pool; int index; };
+    static worker_t &this_worker() {
+        static thread_local worker_t w = { nullptr, -1 };
+        return w;
+    }
+    static int worker_index(void *ctx) {
+        const worker_t &w = this_worker();
+        return w.pool == ctx ? w.index : -1;
+    }
+
+    void start() {
+        started_ = true;
+        for (int i = 1; i < nthr_; ++i)
+            workers_.emplace_back([this, i]() { work(i); });
+    }
+
+    void run_tasks() {
+        const int n = n_;
+        for (int i = next_++; i < n; i = next_++) {
+            task_(task_arg_, i);
+            done_.fetch_add(1, std::memory_order_release);
+        }
+    }
+
+    void work(int index) {
+        this_worker() = { this, index };
+        unsigned seen = 0;
+        for (;;) {
+            /* spin first: the next section usually comes right away */
+            for (int spin = 0; spin < (1 << 16)
+                    && generation_.load(std::memory_order_acquire) == seen;
+                    ++spin)
+                std::this_thread::yield();
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [&]() { return generation_ != seen; });
+            seen = generation_;
+            if (stop_) return;
+            ++active_;
+            lock.unlock();
+
+            run_tasks();
+            --active_;
+        }
+    }
+
+    mkldnn_threadpool_t iface_;
+    const int nthr_;
+    bool started_;
+    bool stop_;
+    std::vector<std::thread> workers_;
+    std::mutex section_mutex_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<unsigned> generation_;
+    void (*task_)(void *, int);
+    void *task_arg_;
+    int n_;
+    std::atomic<int> next_;
+    std::atomic<int> done_;
+    std::atomic<int> active_;
+};
+
+/* The number of threads: OMP_NUM_THREADS if set, to compare with the
+ * OpenMP builds, or the number of the hardware threads */
+inline int default_num_threads() {
+    const char *s = getenv("OMP_NUM_THREADS");
+    int nthr = s ? atoi(s) : 0;
+    if (nthr <= 0) nthr = (int)std::thread::hardware_concurrency();
+    return nthr;
+}
+
+/* Makes a process-wide threadpool the default executor of the library; a
+ * no-op unless the library is built with MKLDNN_THREADING=THREADPOOL */
+inline void set_default_threadpool() {
+    static threadpool_t tp(default_num_threads());
+    mkldnn_set_threadpool(tp.iface());
+}
+
+}
+
+#endif